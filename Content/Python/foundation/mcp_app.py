@@ -1,9 +1,12 @@
 import asyncio
+import functools
+import inspect
 import logging
 import this
 import time
 import os
 import queue
+import itertools
 import traceback
 from typing import Any, Awaitable, Callable, Sequence, Optional
 import uuid
@@ -15,6 +18,7 @@ import json
 import unreal
 from mcp.server.fastmcp import FastMCP
 from mcp.server.fastmcp.server import Settings
+import pydantic_core
 import uvicorn
 import socket
 from foundation import global_context
@@ -49,6 +53,63 @@ def _agent_dbg_log(*, hypothesisId: str, location: str, message: str, data: dict
     except Exception:
         pass
 # endregion agent log (debug mode)
+
+def _mcp_subsystem() -> Any:
+    try:
+        return unreal.MCPSubsystem.get()  # type: ignore
+    except Exception:
+        return None
+
+class TaskPriority:
+    """game thread 任务优先级，数值越小越先执行。"""
+    INTERACTIVE = 0  # 查询类，需要尽快返回
+    NORMAL = 1
+    BULK = 2  # 批量编辑，可以让位给交互请求
+
+def push_server_state(state: Any) -> None:
+    """把服务器状态推送给 C++（UMCPSubsystem 缓存），C++ 侧不再每帧回调 python 做心跳。"""
+    subsystem = _mcp_subsystem()
+    if subsystem is not None:
+        subsystem.set_server_state(state)
+
+def _response_format() -> Any:
+    try:
+        return unreal.get_default_object(unreal.MCPSetting).get_editor_property("response_format")  # type: ignore
+    except Exception:
+        return None
+
+_CONTENT_TYPES = (TextContent, ImageContent, EmbeddedResource, CallToolResult)
+
+def _format_result(result: Any) -> Any:
+    """MCP 输出边界：dict/list 结果按 MCPSetting.ResponseFormat 序列化，C++ bridge 始终返回紧凑 JSON。"""
+    if isinstance(result, list) and any(isinstance(item, _CONTENT_TYPES) for item in result):
+        return result
+    if not isinstance(result, (dict, list)):
+        return result
+    fmt = _response_format()
+    if fmt == unreal.MCPJsonFormat.PRETTY:  # type: ignore
+        return result  # FastMCP 默认即 indent=2
+    text = pydantic_core.to_json(result, fallback=str).decode()
+    if fmt == unreal.MCPJsonFormat.ABBREVIATED and isinstance(result, dict):  # type: ignore
+        text = unreal.MCPPythonBridge.format_json(text, fmt)  # type: ignore
+    return [TextContent(type="text", text=text)]
+
+def _with_response_format(fn: AnyFunction) -> AnyFunction:
+    """包装工具函数，在返回 MCP 前只格式化一次结果；参数签名保持不变（去掉返回注解，结果类型已改变）。"""
+    if inspect.iscoroutinefunction(fn):
+        @functools.wraps(fn)
+        async def async_wrapper(*args: Any, **kwargs: Any) -> Any:
+            return _format_result(await fn(*args, **kwargs))
+        wrapper: Any = async_wrapper
+    else:
+        @functools.wraps(fn)
+        def sync_wrapper(*args: Any, **kwargs: Any) -> Any:
+            return _format_result(fn(*args, **kwargs))
+        wrapper = sync_wrapper
+    wrapper.__signature__ = inspect.signature(fn).replace(return_annotation=inspect.Signature.empty)
+    wrapper.__annotations__ = {k: v for k, v in getattr(fn, "__annotations__", {}).items() if k != "return"}
+    return wrapper
+
 class UnrealMCP(FastMCP):
     def __init__(self, name: str | None = None, instructions: str | None = None, **settings: Any):
         super().__init__(name=name, instructions=instructions, **settings)
@@ -59,8 +120,11 @@ class UnrealMCP(FastMCP):
         self.should_exit = False
         self.uuid = uuid.uuid4()
         # 任务队列：server loop 线程 -> 游戏线程 tick loop（跨线程），必须用线程安全队列
-        # item = (func, args, kwargs, origin_loop, origin_future)
-        self.task_queue: "queue.Queue[tuple[Callable, tuple[Any, ...], dict[str, Any], asyncio.AbstractEventLoop, asyncio.Future]]" = queue.Queue()
+        # item = (priority, seq, (func, args, kwargs, origin_loop, origin_future))；同优先级按入队顺序
+        self.task_queue: "queue.PriorityQueue[tuple[int, int, tuple[Callable, tuple[Any, ...], dict[str, Any], asyncio.AbstractEventLoop, asyncio.Future]]]" = queue.PriorityQueue()
+        self._task_seq = itertools.count()
+        # 工具名（或 "domain:name"）-> TaskPriority
+        self._tool_priority: dict[str, int] = {}
         # 游戏线程（每帧调用 sync_tick）专用事件循环：必须是“持久化”的，才能让 Awaitable 跨帧推进
         self._tick_loop: asyncio.AbstractEventLoop = asyncio.new_event_loop()
         # 正在执行中的协程任务（跨帧）
@@ -82,6 +146,10 @@ class UnrealMCP(FastMCP):
         #self.tick_loop =  asyncio.SelectorEventLoop()
         global_context.rebuild_event_loop()
 
+    def add_tool(self, fn: AnyFunction, *args: Any, **kwargs: Any) -> None:
+        """所有经 add_tool 注册的工具（@tool / game_thread_tool）都在这里套上响应格式化。"""
+        super().add_tool(_with_response_format(fn), *args, **kwargs)
+
     def sync_run_func(self, function: Any) -> None:
         # 运行函数
         loop = global_context.get_event_loop()
@@ -101,6 +169,7 @@ class UnrealMCP(FastMCP):
         # 必须同步清理 game_thread 标记，否则热重载后旧标记残留，
         # 导致同名工具的线程调度行为与新注册的 decorator 不一致
         self._game_thread_tool_set.clear()
+        self._tool_priority.clear()
         self._domain_tools.clear()
         self._domain_game_thread_tools.clear()
         self._domain_meta.clear()
@@ -126,7 +195,9 @@ class UnrealMCP(FastMCP):
         except Exception as e:
             unreal.log_error("Error initializing bridge: " + str(e))
             await self.shutdown()
+            push_server_state(unreal.MCPServerState.STOP)
             return
+        push_server_state(unreal.MCPServerState.RUNING)
         
         while not self.should_exit :
             if self.server is not None:  # guard: server 可能在 start_up 异常后为 None
@@ -134,7 +205,9 @@ class UnrealMCP(FastMCP):
             await asyncio.sleep(1)
             if self.need_reload:
                 self.reload_all_tools()
+        push_server_state(unreal.MCPServerState.STOPPING)
         await self.shutdown()
+        push_server_state(unreal.MCPServerState.STOP)
         
         pass
 
@@ -250,7 +323,15 @@ class UnrealMCP(FastMCP):
                     pass
 
         await self.do_task()
+        self._report_pending_work()
         return True
+
+    def _report_pending_work(self) -> None:
+        """告诉 C++ 是否还有未完成的任务；没有时 UMCPSubsystem::Tick 会跳过 python 调用。"""
+        subsystem = _mcp_subsystem()
+        if subsystem is not None:
+            pending = (not self.task_queue.empty()) or bool(self._inflight_tasks) or bool(self._next_frame_waiters)
+            subsystem.set_pending_work(pending)
     
 
     
@@ -263,12 +344,13 @@ class UnrealMCP(FastMCP):
         - Awaitable 任务：不在当前帧 await 到结束，而是创建 asyncio.Task，让它在后续帧继续推进
           （协程需要在合适的位置 `await self.next_frame()` 或 `await asyncio.sleep(0)` 等来让出执行权）
         """
-        max_new_tasks_per_tick = 32  # 防止单帧把队列耗尽导致卡顿
+        # 按时间片出队：每帧最多花 budget 毫秒（由 UMCPSetting 配置，编辑器空闲/失焦时放宽），至少执行一个任务
+        deadline = time.perf_counter() + self._task_budget_ms() / 1000.0
         created = 0
 
-        while created < max_new_tasks_per_tick:
+        while created == 0 or time.perf_counter() < deadline:
             try:
-                func, args, kwargs, origin_loop, origin_future = self.task_queue.get_nowait()
+                _, _, (func, args, kwargs, origin_loop, origin_future) = self.task_queue.get_nowait()
             except queue.Empty:
                 break
             try:
@@ -326,12 +408,27 @@ class UnrealMCP(FastMCP):
         await asyncio.sleep(0)
         
                 
+    def _task_budget_ms(self) -> float:
+        subsystem = _mcp_subsystem()
+        if subsystem is not None:
+            try:
+                return float(subsystem.get_task_budget_ms())
+            except Exception:
+                pass
+        return 4.0
+
     async def to_tick_thread(self, func:Callable, *args: Any, **kwargs: Any) -> Any:
+        return await self.to_tick_thread_with_priority(TaskPriority.NORMAL, func, *args, **kwargs)
+
+    async def to_tick_thread_with_priority(self, priority: int, func:Callable, *args: Any, **kwargs: Any) -> Any:
         # 将函数添加到任务队列（server loop 线程 -> 游戏线程）
         unreal.log("Add task to game thread task queue")
         origin_loop = asyncio.get_running_loop()
         origin_future = origin_loop.create_future()
-        self.task_queue.put((func, args, kwargs, origin_loop, origin_future))
+        self.task_queue.put((priority, next(self._task_seq), (func, args, kwargs, origin_loop, origin_future)))
+        subsystem = _mcp_subsystem()
+        if subsystem is not None:
+            subsystem.notify_task_queued()
         return await origin_future
     
     async def call_tool(self, name: str, arguments: dict[str, Any]) -> Sequence[TextContent | ImageContent | EmbeddedResource] | Any:
@@ -344,7 +441,8 @@ class UnrealMCP(FastMCP):
                 # 使用闭包捕获所需的参数和方法
                 async def wrapped_call_tool(self_ref=self, name_ref=name, args_ref=arguments, parent_method=parent_call_tool):
                     return await parent_method(self_ref, name_ref, args_ref)
-                return await self.to_tick_thread(wrapped_call_tool)
+                priority = self._tool_priority.get(name, TaskPriority.NORMAL)
+                return await self.to_tick_thread_with_priority(priority, wrapped_call_tool)
             return await super().call_tool(name, arguments)
         except Exception as e:
             info = f"Error calling tool {name}: {str(e)}"
@@ -356,9 +454,11 @@ class UnrealMCP(FastMCP):
     
     
     def game_thread_tool(
-        self, name: str | None = None, description: str | None = None
+        self, name: str | None = None, description: str | None = None, priority: int = TaskPriority.NORMAL
     ) -> Callable[[AnyFunction], AnyFunction]:
-        """Decorator to register a tool."""
+        """Decorator to register a tool.
+        priority: TaskPriority of the game thread task; INTERACTIVE runs before NORMAL/BULK.
+        """
 
         # Check if user passed function directly instead of calling decorator
         if callable(name):
@@ -371,6 +471,7 @@ class UnrealMCP(FastMCP):
             fn_desc = f'(GameThread){description or fn.__doc__}' 
             func_name =  name or fn.__name__
             self._game_thread_tool_set.add(func_name)
+            self._tool_priority[func_name] = priority
 
             # region agent log (debug mode)
             # H1: 热重载没有替换旧工具（ToolManager.add_tool 返回 existing）
@@ -402,7 +503,8 @@ class UnrealMCP(FastMCP):
         name: str | None = None, 
         description: str | None = None,
         domain_description: str | None = None,
-        game_thread: bool = True
+        game_thread: bool = True,
+        priority: int = TaskPriority.NORMAL
     ) -> Callable[[AnyFunction], AnyFunction]:
         """
         装饰器：注册一个 domain tool。
@@ -415,6 +517,7 @@ class UnrealMCP(FastMCP):
             name: 工具名称，默认使用函数名
             description: 工具描述，默认使用函数 docstring
             game_thread: 是否在游戏主线程执行，默认 True
+            priority: game thread 任务优先级（TaskPriority），查询类用 INTERACTIVE，批量编辑用 BULK
             
         用法:
             @mcp.domain_tool("animation")
@@ -442,13 +545,14 @@ class UnrealMCP(FastMCP):
                 self._domain_meta[domain]["description"] = domain_description or ""
             
             # 创建 Tool 对象但不加入 _tool_manager
-            tool = Tool.from_function(fn, name=func_name, description=fn_desc)
+            tool = Tool.from_function(_with_response_format(fn), name=func_name, description=fn_desc)
             self._domain_tools[domain][func_name] = tool
             
             # 记录是否需要 game thread
             if game_thread:
                 full_key = f"{domain}:{func_name}"
                 self._domain_game_thread_tools.add(full_key)
+                self._tool_priority[full_key] = priority
             
             unreal.log(f"[DomainTool] Registered: {domain}/{func_name}")
             return fn
@@ -626,7 +730,8 @@ class UnrealMCP(FastMCP):
                 # 在 game thread 中执行
                 async def wrapped_call():
                     return await tool.run(arguments)
-                return await self.to_tick_thread(wrapped_call)
+                priority = self._tool_priority.get(full_key, TaskPriority.NORMAL)
+                return await self.to_tick_thread_with_priority(priority, wrapped_call)
             else:
                 # 直接执行
                 return await tool.run(arguments)
@@ -1,3 +1,4 @@
+import asyncio
 import json
 from typing import Any, Callable,Optional
 
@@ -50,6 +51,53 @@ def parameter_to_string(json_obj: unreal.JsonObjectParameter) -> str:
 def to_py_json(json_obj: unreal.JsonObjectParameter) -> dict:
     return json.loads(parameter_to_string(json_obj))
 
+_native_tool_names: dict[Callable, Optional[str]] = {}
+
+def native_tool_name(function : Callable) -> Optional[str]:
+    """Resolve the native registry name ("MCPEdGraphTools.handle_add_node") of a reflected handler.
+    Returns None when the handler is not registered in the C++ tool registry.
+    """
+    if function in _native_tool_names:
+        return _native_tool_names[function]
+    name = None
+    owner = getattr(function, "__self__", None)
+    owner_name = owner.__name__ if isinstance(owner, type) else getattr(owner, "__name__", None)
+    func_name = getattr(function, "__name__", None)
+    if owner_name and func_name:
+        candidate = f"{owner_name}.{func_name}"
+        if unreal.MCPPythonBridge.has_tool(candidate): # type: ignore
+            name = candidate
+    _native_tool_names[function] = name
+    return name
+
+def call_native_tool(name: str, params: dict) -> dict:
+    """Call a C++ handler through the native tool registry by name."""
+    return json.loads(unreal.MCPPythonBridge.call_tool(name, json.dumps(params))) # type: ignore
+
+def call_native_tool_utf8(name: str, params: dict) -> dict:
+    """Same as call_native_tool, but the request and response cross the bridge as UTF-8 bytes.
+    Unreal's reflection copies TArray<uint8> element by element, so this only pays off for small requests
+    with large, mostly non-ASCII responses; call_native_tool stays the default.
+    """
+    ret = unreal.MCPPythonBridge.call_tool_utf8(name, json.dumps(params).encode("utf-8")) # type: ignore
+    return json.loads(bytes(ret))
+
+async def call_cpp_tools_async(function : Callable, params: dict) -> dict:
+    """Run a C++ handler through the native scheduler without blocking the caller's event loop.
+    Handlers tagged MCPThreadSafe run on the UE task pool in a per-frame read window, the others on the game thread.
+    """
+    name = native_tool_name(function)
+    if name is None:
+        return call_cpp_tools(function, params)
+    request_id = unreal.MCPPythonBridge.submit_tool(name, json.dumps(params)) # type: ignore
+    delay = 0.001
+    while True:
+        str_ret = unreal.MCPPythonBridge.try_get_tool_result(request_id) # type: ignore
+        if str_ret:
+            return json.loads(str_ret)
+        await asyncio.sleep(delay)
+        delay = min(delay * 2, 0.02)
+
 def call_cpp_tools(function : Callable, params: dict) -> dict:
     # json_params = to_unreal_json(params)
     # return to_py_json(function(json_params))
@@ -58,12 +106,26 @@ def call_cpp_tools(function : Callable, params: dict) -> dict:
 
 def safe_call_cpp_tools(function : Callable, params: dict) -> str:
     json_params = json.dumps(params)
+    name = native_tool_name(function)
+    if name is not None:
+        return unreal.MCPPythonBridge.call_tool(name, json_params) # type: ignore
+    # not registered natively, fall back to the delegate round-trip
     closure  = UnrealDelegateProxy(function)
     delegate = unreal.MCPCommandDelegate()
     delegate.bind_callable(closure.call)
     return unreal.MCPPythonBridge.safe_call_cpp_function(delegate,json_params) # type: ignore
     
 
+def page_params(params: dict, limit: int = 0, cursor: str = "", fields: str = "") -> dict:
+    """Add the C++ list paging contract (limit / cursor / fields) to params; unset values are left out."""
+    if limit > 0:
+        params["limit"] = limit
+    if cursor:
+        params["cursor"] = cursor
+    if fields:
+        params["fields"] = fields
+    return params
+
 def like_str_parameter(params:dict | str, name:str, default_value:Any) -> Any:
     if isinstance(params, dict):
         return params.get(name, default_value)
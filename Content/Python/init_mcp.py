@@ -14,7 +14,7 @@ from foundation import log_handler
 import warnings
 
 try:
-    from foundation.mcp_app import UnrealMCP
+    from foundation.mcp_app import UnrealMCP, push_server_state
 except Exception as e:
     import traceback
 
@@ -74,7 +74,9 @@ def on_bridge(type: unreal.MCPBridgeFuncType, message: str):
     if type == unreal.MCPBridgeFuncType.START:
         instance = global_context.get_mcp_instance()
         if instance is not None:
+            push_server_state(unreal.MCPServerState.RUNING)
             return False
+        push_server_state(unreal.MCPServerState.STARTING)
         instance = init_mcp()
         instance.unreal_run()
 
@@ -83,6 +85,7 @@ def on_bridge(type: unreal.MCPBridgeFuncType, message: str):
         # 不直接调用 shutdown()——它是 async 函数，在 sync 上下文中调用会产生未 await 的协程
         instance = global_context.get_mcp_instance()
         if instance is not None:
+            push_server_state(unreal.MCPServerState.STOPPING)
             instance.should_exit = True
             global_context.set_mcp_instance(None)
 
@@ -93,6 +96,7 @@ def on_bridge(type: unreal.MCPBridgeFuncType, message: str):
         instance.clear_all()
         tool_register.reload_all_tools(instance)
 
+    # C++ 侧已改为读取 push_server_state 推送的缓存状态，这里只保留兼容
     elif type == unreal.MCPBridgeFuncType.HEARTBEAT_PACKET:
         instance = global_context.get_mcp_instance()
         return instance is not None
@@ -1,10 +1,11 @@
 
 import asyncio
+import json
 from asyncio.windows_events import NULL
 import time
 from typing import Any, Awaitable, Dict, List, Optional
 from foundation.log_handler import LogCaptureScope
-from foundation.mcp_app import UnrealMCP
+from foundation.mcp_app import TaskPriority, UnrealMCP
 from mcp.server.fastmcp.server import FastMCP
 from mcp.types import CallToolResult, TextContent
 import unreal
@@ -190,7 +191,8 @@ def register_common_tools(mcp : UnrealMCP):
                 content=[TextContent(type="text", text=f"Async script execution failed. {str(e)}")],
             )
 
-    @mcp.game_thread_tool()
+    # IConsoleManager 的遍历自带锁，可直接在 server 线程执行，不占用 game thread 队列
+    @mcp.tool()
     def search_console_commands(keyword: str):
         """Search the console commands by a specific keyword.
         Args:
@@ -251,7 +253,7 @@ def register_common_tools(mcp : UnrealMCP):
         
         pass
 
-    @mcp.game_thread_tool()
+    @mcp.game_thread_tool(priority=TaskPriority.INTERACTIVE)
     def get_unreal_state() -> Dict[str, Any]:
         """获取 Unreal Engine 环境与连接状态的综合信息。
 
@@ -350,6 +352,29 @@ def register_common_tools(mcp : UnrealMCP):
                 "error_type": type(e).__name__,
             }
 
+    @mcp.game_thread_tool(priority=TaskPriority.INTERACTIVE)
+    def list_native_tools() -> List[str]:
+        """List the C++ tool handlers that can be used as `tool` in batch_call,
+        e.g. "MCPEdGraphTools.HandleAddNode".
+        """
+        return list(unreal.MCPPythonBridge.list_tools())
+
+    @mcp.game_thread_tool(priority=TaskPriority.BULK)
+    def batch_call(steps: List[Dict[str, Any]], stop_on_error: bool = True, transaction: bool = True) -> Dict[str, Any]:
+        """Run many C++ tool calls in one game-thread task and one undo transaction.
+        Args:
+            steps: ordered list of {"tool": "<Class>.<Handler>", "arguments": {...}, "id": "optional step id"}.
+                Tool names come from list_native_tools.
+                A string argument "$ref:<step>.<path>" is replaced with a value from the result of an earlier step,
+                where <step> is the step index or id, e.g. "$ref:add_node.node_guid" or "$ref:0.pins.1.name".
+            stop_on_error: stop at the first failing step (default True).
+            transaction: group every step into a single undo entry (default True).
+        Returns:
+            {success, completed, total, results: [{index, id, tool, success, result | error}]}
+        """
+        params = {"steps": steps, "stop_on_error": stop_on_error, "transaction": transaction}
+        return json.loads(unreal.MCPPythonBridge.batch_call(json.dumps(params)))
+
     @mcp.game_thread_tool()
     def reload_all_tool():
         """热重载所有的tools"""
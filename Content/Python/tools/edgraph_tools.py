@@ -5,7 +5,7 @@ from typing import Any, Dict
 
 import unreal
 from foundation.mcp_app import UnrealMCP
-from foundation.utility import call_cpp_tools
+from foundation.utility import call_cpp_tools, call_cpp_tools_async, page_params
 
 
 def register_edgraph_tools(mcp: UnrealMCP):
@@ -35,8 +35,8 @@ def register_edgraph_tools(mcp: UnrealMCP):
             return {"status": "error", "message": f"Failed to read API reference: {e}"}
         return {"status": "success", "data": {"reference": content}}
 
-    @mcp.domain_tool("edgraph")
-    def edgraph_find_graphs_in_asset(asset_path: str, name_filter: str = "", max_results: int = 50) -> Dict[str, Any]:
+    @mcp.domain_tool("edgraph", game_thread=False)
+    async def edgraph_find_graphs_in_asset(asset_path: str, name_filter: str = "", max_results: int = 50) -> Dict[str, Any]:
         """
         在指定资产里发现所有 EdGraph（支持 Blueprint、BehaviorTree 等多种资产类型）。
 
@@ -45,33 +45,53 @@ def register_edgraph_tools(mcp: UnrealMCP):
             name_filter: 可选，按 graph path/name 包含过滤（不区分大小写）
             max_results: 最多返回多少个
         """
-        return call_cpp_tools(unreal.MCPEdGraphTools.handle_find_graphs_in_asset, {
+        return await call_cpp_tools_async(unreal.MCPEdGraphTools.handle_find_graphs_in_asset, {
             "asset_path": asset_path,
             "name_filter": name_filter,
             "max_results": max_results,
         })
 
-    @mcp.domain_tool("edgraph")
-    def edgraph_list_nodes(graph_path: str, include_properties: bool = False) -> Dict[str, Any]:
-        """列出图内所有节点及其 pin 信息。"""
-        return call_cpp_tools(unreal.MCPEdGraphTools.handle_list_graph_nodes, {
+    @mcp.domain_tool("edgraph", game_thread=False)
+    async def edgraph_list_nodes(
+        graph_path: str,
+        include_properties: bool = False,
+        include_export_text: bool = False,
+        limit: int = 0,
+        cursor: str = "",
+        fields: str = "",
+    ) -> Dict[str, Any]:
+        """
+        列出图内所有节点及其 pin 信息。
+
+        Args:
+            include_properties: 附带节点属性（类型 + JSON 值）
+            include_export_text: 属性额外附带 ExportText（import_text 格式），仅在需要时开启
+            limit: 每页最多返回多少个节点，0 表示全部
+            cursor: 上一页返回的 next_cursor
+            fields: 只返回这些字段，逗号分隔，如 "name,guid"（可选 name/path/class/guid/pos_x/pos_y/title/comment/pins/properties）；
+                不含 title 时在工作线程并行执行，否则转到 game thread
+        """
+        return await call_cpp_tools_async(unreal.MCPEdGraphTools.handle_list_graph_nodes, page_params({
             "graph_path": graph_path,
             "include_properties": include_properties,
-        })
+            "include_export_text": include_export_text,
+        }, limit, cursor, fields))
 
-    @mcp.domain_tool("edgraph")
-    def edgraph_get_node(
+    @mcp.domain_tool("edgraph", game_thread=False)
+    async def edgraph_get_node(
         graph_path: str,
         node_guid: str = "",
         node_name: str = "",
         node_path: str = "",
+        include_export_text: bool = False,
     ) -> Dict[str, Any]:
-        """按 guid/name/path 查询单个节点（含详细 pin 信息）。"""
-        return call_cpp_tools(unreal.MCPEdGraphTools.handle_get_graph_node, {
+        """按 guid/name/path 查询单个节点（含详细 pin 信息）；include_export_text 时属性附带 ExportText。"""
+        return await call_cpp_tools_async(unreal.MCPEdGraphTools.handle_get_graph_node, {
             "graph_path": graph_path,
             "node_guid": node_guid,
             "node_name": node_name,
             "node_path": node_path,
+            "include_export_text": include_export_text,
         })
 
     @mcp.domain_tool("edgraph")
@@ -117,12 +137,18 @@ def register_edgraph_tools(mcp: UnrealMCP):
             "auto_save_asset_path": auto_save_asset_path,
         })
 
-    @mcp.domain_tool("edgraph")
-    def edgraph_list_links(graph_path: str) -> Dict[str, Any]:
-        """枚举图里所有 pin 连接（去重后输出）。"""
-        return call_cpp_tools(unreal.MCPEdGraphTools.handle_list_graph_links, {
+    @mcp.domain_tool("edgraph", game_thread=False)
+    async def edgraph_list_links(graph_path: str, limit: int = 0, cursor: str = "", fields: str = "") -> Dict[str, Any]:
+        """
+        枚举图里所有 pin 连接（去重后输出）。
+
+        Args:
+            limit / cursor: 分页，cursor 取上一页的 next_cursor
+            fields: 每个端点返回的字段，逗号分隔（node_guid/node_name/pin）
+        """
+        return await call_cpp_tools_async(unreal.MCPEdGraphTools.handle_list_graph_links, page_params({
             "graph_path": graph_path,
-        })
+        }, limit, cursor, fields))
 
     @mcp.domain_tool("edgraph")
     def edgraph_connect_pins(
@@ -194,7 +220,7 @@ def register_edgraph_tools(mcp: UnrealMCP):
 
         Args:
             graph_path: 目标图的 UObject 路径
-            node_class: 节点类名（如 K2Node_CallFunction, K2Node_IfThenElse）
+            node_class: 节点类名（如 K2Node_CallFunction, K2Node_IfThenElse；可省略前缀写作 CallFunction，找不到时错误信息会给出相近类名）
             pos_x, pos_y: 节点位置
             import_text: dict，{PropertyName: "ImportText value"}，在 AllocateDefaultPins 前应用
             pin_defaults: dict，{PinName: "default value"}，在 AllocateDefaultPins 后应用
@@ -251,6 +277,46 @@ def register_edgraph_tools(mcp: UnrealMCP):
             "auto_save_asset_path": auto_save_asset_path,
         })
 
+    @mcp.domain_tool("edgraph")
+    def edgraph_apply_patch(
+        graph_path: str,
+        nodes: Any = None,
+        links: Any = None,
+        defaults: Any = None,
+        properties: Any = None,
+        comments: Any = None,
+        delete: Any = None,
+        auto_save_asset_path: str = "",
+    ) -> Dict[str, Any]:
+        """
+        在一个事务内对图做批量修改（建节点、连线、设默认值、删节点），新增内容只通知一次图变化。
+        执行顺序：delete、nodes、comments、properties（改过属性的节点会重建 pin）、links、defaults。
+        批量生成节点时应优先使用本工具，而不是逐个调用 add_node / connect_pins / set_pin_default。
+
+        Args:
+            graph_path: 图路径
+            nodes: [{id, node_class, pos_x, pos_y, import_text, pin_defaults}]，id 为本次补丁内的局部 id
+            links: [{from_node, from_pin, to_node, to_pin}]，节点可写局部 id，或已有节点的 GUID / 名称
+            defaults: [{node, pin, value, object?, direction?}]
+            properties: [{node, values: {PropertyName: value}}]
+            comments: [{id?, comment, pos_x, pos_y, width, height}]
+            delete: 要删除的已有节点 GUID / 名称列表（最先执行）
+            auto_save_asset_path: 可选，应用后保存资产
+
+        Returns: {ids: {局部 id: GUID}, created, deleted, linked, defaults_set, errors?[]}
+        """
+        params = {"graph_path": graph_path}
+        for key, value in (("nodes", nodes), ("links", links), ("defaults", defaults),
+                           ("properties", properties), ("comments", comments), ("delete", delete)):
+            if value is not None:
+                if isinstance(value, str):
+                    import json as _json
+                    value = _json.loads(value)
+                params[key] = value
+        if auto_save_asset_path:
+            params["auto_save_asset_path"] = auto_save_asset_path
+        return call_cpp_tools(unreal.MCPEdGraphTools.handle_apply_graph_patch, params)
+
     @mcp.domain_tool("edgraph")
     def edgraph_compile(asset_path: str) -> Dict[str, Any]:
         """
@@ -295,13 +361,13 @@ def register_edgraph_tools(mcp: UnrealMCP):
             "graph_path": graph_path,
         })
 
-    @mcp.domain_tool("edgraph")
-    def edgraph_get_asset_info(asset_path: str) -> Dict[str, Any]:
+    @mcp.domain_tool("edgraph", game_thread=False)
+    async def edgraph_get_asset_info(asset_path: str) -> Dict[str, Any]:
         """
         查询蓝图资产元数据：父类、变量、函数、接口、组件、所有图。
 
         Returns: {parent_class, variables[], functions[], interfaces[], components[], graphs[]}
         """
-        return call_cpp_tools(unreal.MCPEdGraphTools.handle_get_asset_info, {
+        return await call_cpp_tools_async(unreal.MCPEdGraphTools.handle_get_asset_info, {
             "asset_path": asset_path,
         })
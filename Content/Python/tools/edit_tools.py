@@ -4,7 +4,7 @@ from mcp.server.fastmcp import Context
 import unreal
 
 import foundation.utility as unreal_utility
-from foundation.utility import call_cpp_tools
+from foundation.utility import call_cpp_tools, page_params
 
 
 
@@ -25,176 +25,91 @@ def register_edit_tool( mcp:UnrealMCP):
     )
 
     @mcp.domain_tool("level")
-    def get_actors_in_level(ctx: Context) -> List[Dict[str, Any]]:
-        """Get a list of all actors in the current level."""
-        try:
-            # 使用纯Python实现获取所有Actor
-            all_actors = unreal.EditorLevelLibrary.get_all_level_actors()
-            
-            actors_info = []
-            for actor in all_actors:
-                if actor:
-                    actor_info = {
-                        "name": actor.get_name(),
-                        "path": actor.get_path_name(),
-                        "class": actor.get_class().get_name(),
-                        "location": [
-                            actor.get_actor_location().x, 
-                            actor.get_actor_location().y, 
-                            actor.get_actor_location().z
-                        ],
-                        "rotation": [
-                            actor.get_actor_rotation().pitch, 
-                            actor.get_actor_rotation().yaw, 
-                            actor.get_actor_rotation().roll
-                        ],
-                        "scale": [
-                            actor.get_actor_scale3d().x, 
-                            actor.get_actor_scale3d().y, 
-                            actor.get_actor_scale3d().z
-                        ]
-                    }
-                    actors_info.append(actor_info)
-            
-            unreal.log(f"Found {len(actors_info)} actors in level")
-            return actors_info
-            
-        except Exception as e:
-            unreal.log_error(f"Error getting actors in level: {e}")
-            return []
-    
+    def get_actors_in_level(
+        ctx: Context,
+        actor_class: str = "",
+        include_subclasses: bool = True,
+        tags: Optional[List[str]] = None,
+        tag_match: str = "all",
+        folder: str = "",
+        level: str = "",
+        data_layer: str = "",
+        name_contains: str = "",
+        where: Optional[List[Dict[str, Any]]] = None,
+        limit: int = 0,
+        cursor: str = "",
+        fields: str = "",
+    ) -> Dict[str, Any]:
+        """
+        List the actors in the current level, filtered on the editor side.
+
+        Args:
+            actor_class: Class name or path, e.g. "StaticMeshActor" or "BP_Tree"
+            include_subclasses: Also match subclasses of actor_class
+            tags: Actor tags to match
+            tag_match: "all" or "any" of the tags
+            folder: Outliner folder, subfolders included
+            level: Level (sub-level) name or package path
+            data_layer: Data layer name
+            name_contains: Substring of the actor name or label
+            where: Property predicates, e.g. [{"property": "bHidden", "op": "==", "value": false}];
+                   op is one of == != < <= > >= contains
+            limit / cursor: Optional paging, ordered by actor path
+            fields: Optional field projection; label, folder, level and tags are only returned when requested
+
+        Returns:
+            {"actors": [...], "total", "next_cursor"?}
+        """
+        params: Dict[str, Any] = {}
+        if actor_class:
+            params["class"] = actor_class
+            params["include_subclasses"] = include_subclasses
+        if tags:
+            params["tags"] = tags
+            params["tag_match"] = tag_match
+        if folder:
+            params["folder"] = folder
+        if level:
+            params["level"] = level
+        if data_layer:
+            params["data_layer"] = data_layer
+        if name_contains:
+            params["name_contains"] = name_contains
+        if where:
+            params["where"] = where
+        return call_cpp_tools(unreal.MCPEditorTools.handle_get_actors_in_level, page_params(params, limit, cursor, fields))
+
     @mcp.domain_tool("level")
-    def get_actors_detail_info(ctx: Context, actor_name : str) -> Dict:
-        """Get detailed information of the specified actor by name, including its basic properties and all component properties."""
-        try:
-            all_actors = unreal.EditorLevelLibrary.get_all_level_actors()
-
-            # INSERT_YOUR_CODE
-            # 判断路径中是否包含对应名字
-            matched_actors = []
-            for ac in all_actors:
-                path = ac.get_path_name()
-                if actor_name in path:
-                    matched_actors.append(ac)
-                    break
-            actor = matched_actors
-            if not actor or len(actor) == 0:
-                return {"error": "Actor not found", "actor": actor_name}
-
-            actor = actor[0]
-            # INSERT_YOUR_CODE
-            # 实现逐组件逐属性的Json化
-            actor_info = {
-                "name": actor.get_name(),
-                "path": actor.get_path_name(),
-                "class": actor.get_class().get_name(),
-                "location": [
-                    actor.get_actor_location().x,
-                    actor.get_actor_location().y,
-                    actor.get_actor_location().z
-                ],
-                "rotation": [
-                    actor.get_actor_rotation().pitch,
-                    actor.get_actor_rotation().yaw,
-                    actor.get_actor_rotation().roll
-                ],
-                "scale": [
-                    actor.get_actor_scale3d().x,
-                    actor.get_actor_scale3d().y,
-                    actor.get_actor_scale3d().z
-                ],
-                "components": []
-            }
-
-            def _to_jsonable(v, depth: int = 0, seen: set[int] | None = None):
-                """将 UE/Python 任意值转换为 JSON-safe（避免 Pydantic 序列化 unknown type，如 SleepFamily）。"""
-                if seen is None:
-                    seen = set()
-                # 防止递归爆炸/循环引用
-                if depth >= 6:
-                    return str(v)
-                try:
-                    obj_id = id(v)
-                    if obj_id in seen:
-                        return "<circular_ref>"
-                    seen.add(obj_id)
-                except Exception:
-                    pass
-
-                if v is None or isinstance(v, (str, int, float, bool)):
-                    return v
-
-                # 容器递归处理（list/dict 内部也要转，避免 list[SleepFamily] 这种情况）
-                if isinstance(v, (list, tuple, set)):
-                    return [_to_jsonable(x, depth + 1, seen) for x in v]
-                if isinstance(v, dict):
-                    return {str(k): _to_jsonable(val, depth + 1, seen) for k, val in v.items()}
-
-                # UE 常见结构/对象兜底
-                if hasattr(v, "to_tuple"):
-                    try:
-                        return _to_jsonable(list(v.to_tuple()), depth + 1, seen)
-                    except Exception:
-                        pass
-                if hasattr(v, "get_name"):
-                    try:
-                        return v.get_name()
-                    except Exception:
-                        pass
-
-                # 最终兜底：转字符串
-                try:
-                    return str(v)
-                except Exception as e:
-                    return f"<unserializable:{type(v)}:{e}>"
-
-            # 获取所有组件
-            components = actor.get_components_by_class(unreal.ActorComponent)
-            for comp in components:
-                comp_info = {
-                    "name": comp.get_name(),
-                    "class": comp.get_class().get_name(),
-                    "properties": {}
-                }
-
-                # 尝试枚举属性：UE Python 没有稳定的“列出所有 UPROPERTY”API，这里用启发式方式
-                # - 遍历 dir(comp)，优先用 get_editor_property 读取
-                # - 限制最多读取一定数量，避免输出过大/耗时
-                max_props = 64
-                prop_count = 0
-                for attr in dir(comp):
-                    if prop_count >= max_props:
-                        comp_info["properties_truncated"] = True
-                        break
-                    if attr.startswith("_"):
-                        continue
-                    if attr in ("get_editor_property", "set_editor_property", "reset_editor_property", "is_editor_property_overridden"):
-                        continue
-                    # 只处理看起来像字段的名字（跳过明显的方法名）
-                    if attr.startswith("get_") or attr.startswith("set_") or attr.startswith("is_") or attr.startswith("has_"):
-                        continue
-                    try:
-                        value = comp.get_editor_property(attr)
-                    except Exception:
-                        # 不可作为 editor_property 的项直接跳过
-                        continue
-                    try:
-                        comp_info["properties"][attr] = _to_jsonable(value)
-                        prop_count += 1
-                    except Exception as e:
-                        comp_info["properties"][attr] = f"<无法序列化: {e}>"
-                        prop_count += 1
+    def get_actor_changes_since(ctx: Context, revision: int, fields: str = "") -> Dict[str, Any]:
+        """
+        Get the actors added, modified and removed since a level revision, instead of listing the level again.
 
-                actor_info["components"].append(comp_info)
+        Args:
+            revision: The "revision" returned by get_actors_in_level or by a previous call
+            fields: Optional field projection for added/modified actors
 
-            return actor_info
-            
-        except Exception as e:
-            unreal.log_error(f"Error getting actors in level: {e}")
-            return {"error": str(e), "actors": []}
+        Returns:
+            {"revision", "since", "reset", "added": [...], "modified": [... with "properties"], "removed": [{"name", "path"}]};
+            when reset is true the history is gone and the level has to be listed again
+        """
+        return call_cpp_tools(unreal.MCPEditorTools.handle_get_actor_changes_since, page_params({"revision": revision}, fields=fields))
 
+    @mcp.domain_tool("level")
+    def get_actors_detail_info(
+        ctx: Context,
+        actor_name: str,
+        non_default_only: bool = True,
+        paths: Optional[List[str]] = None,
+        max_depth: int = 4,
+        max_bytes: int = 65536,
+    ) -> Dict[str, Any]:
+        """Get detailed information of the specified actor by name, including its basic properties and all component properties.
+
+        Only values that differ from the class defaults / component templates are returned unless
+        non_default_only is False. See get_actor_properties for the other arguments.
+        """
+        return get_actor_properties(ctx, actor_name, non_default_only, paths, None, max_depth, max_bytes)
 
-    
     @mcp.domain_tool("level")
     def spawn_actor(
         ctx: Context,
@@ -283,11 +198,44 @@ def register_edit_tool( mcp:UnrealMCP):
         }
     
     @mcp.domain_tool("level")
-    def get_actor_properties(ctx: Context, name: str) -> Dict[str, Any]:
-        """Get all properties of an actor."""
-        params = {
+    def get_actor_properties(
+        ctx: Context,
+        name: str,
+        non_default_only: bool = True,
+        paths: Optional[List[str]] = None,
+        exclude: Optional[List[str]] = None,
+        max_depth: int = 4,
+        max_bytes: int = 65536,
+        include_components: bool = True,
+    ) -> Dict[str, Any]:
+        """
+        Get the properties of an actor and its components.
+
+        Args:
+            name: Name, label or path of the actor
+            non_default_only: Only return values that differ from the class defaults / component templates
+            paths: Property paths to return, e.g. ["bHidden", "StaticMeshComponent0.StaticMesh"];
+                   component properties start with the component name. Everything below a path is included.
+            exclude: Property paths to leave out
+            max_depth: Nesting limit for structs and containers
+            max_bytes: Approximate size limit of the response
+            include_components: Also dump the actor's components
+
+        Returns:
+            {"name", "path", "class", "location", "rotation", "scale", "properties", "components": [...],
+             "truncated", "omitted"?}; omitted paths can be fetched with "paths"
+        """
+        params: Dict[str, Any] = {
             "name": name,
+            "non_default_only": non_default_only,
+            "max_depth": max_depth,
+            "max_bytes": max_bytes,
+            "include_components": include_components,
         }
+        if paths:
+            params["paths"] = paths
+        if exclude:
+            params["exclude"] = exclude
         return call_cpp_tools(unreal.MCPEditorTools.handle_get_actor_properties, params)
     @mcp.domain_tool("level")
     def set_actor_property(
@@ -301,7 +249,8 @@ def register_edit_tool( mcp:UnrealMCP):
         
         Args:
             name: Name of the actor
-            property_name: Name of the property to set
+            property_name: Name of the property to set; nested paths such as
+                "BodyInstance.MassScale", "Tags[0]" or "Map[Key].Field" are accepted
             property_value: Value to set the property to
             
         Returns:
@@ -313,6 +262,49 @@ def register_edit_tool( mcp:UnrealMCP):
             "property_value": property_value,
         }
         return call_cpp_tools(unreal.MCPEditorTools.handle_set_actor_property, params)
+
+    @mcp.domain_tool("level")
+    def bulk_set_actor_transforms(
+        ctx: Context,
+        items: List[Dict[str, Any]],
+        transaction_name: str = "",
+    ) -> Dict[str, Any]:
+        """
+        Set the transforms of many actors in one undoable step.
+
+        Args:
+            items: [{"actor": name, "location"?: [X, Y, Z], "rotation"?: [P, Y, R], "scale"?: [X, Y, Z], "relative"?: bool}];
+                   with relative, location/rotation are added and scale is multiplied
+            transaction_name: Optional undo history label
+
+        Returns:
+            {"results": [{"index", "actor", "success", "error"?}], "updated", "failed"}
+        """
+        params: Dict[str, Any] = {"items": items}
+        if transaction_name:
+            params["transaction_name"] = transaction_name
+        return call_cpp_tools(unreal.MCPEditorTools.handle_bulk_set_actor_transforms, params)
+
+    @mcp.domain_tool("level")
+    def bulk_set_actor_properties(
+        ctx: Context,
+        items: List[Dict[str, Any]],
+        transaction_name: str = "",
+    ) -> Dict[str, Any]:
+        """
+        Set properties on many actors in one undoable step.
+
+        Args:
+            items: [{"actor": name, "property": name, "value": value}] or [{"actor": name, "properties": {name: value}}]
+            transaction_name: Optional undo history label
+
+        Returns:
+            {"results": [{"index", "actor", "success", "error"?}], "updated", "failed"}
+        """
+        params: Dict[str, Any] = {"items": items}
+        if transaction_name:
+            params["transaction_name"] = transaction_name
+        return call_cpp_tools(unreal.MCPEditorTools.handle_bulk_set_actor_properties, params)
     @mcp.domain_tool("level")
     def focus_viewport(
         ctx: Context,
@@ -352,7 +344,7 @@ def register_edit_tool( mcp:UnrealMCP):
         
         Args:
             ctx: The MCP context
-            blueprint_name: Name of the Blueprint to spawn from
+            blueprint_name: Name of the Blueprint to spawn from, or its asset path when the name is ambiguous
             actor_name: Name to give the spawned actor
             location: The [x, y, z] world location to spawn at
             rotation: The [pitch, yaw, roll] rotation in degrees
@@ -367,6 +359,178 @@ def register_edit_tool( mcp:UnrealMCP):
             "rotation": rotation
         }
         return call_cpp_tools(unreal.MCPEditorTools.handle_spawn_blueprint_actor, params)
+
+    @mcp.domain_tool("level")
+    def bulk_spawn_actors(
+        ctx: Context,
+        instances: List[Dict[str, Any]],
+        actor_class: str = "",
+        blueprint: str = "",
+        properties: Optional[Dict[str, Any]] = None,
+        folder: str = "",
+        instanced: bool = False,
+        mesh: str = "",
+        name: str = "",
+    ) -> Dict[str, Any]:
+        """
+        Spawn many actors in one undoable step.
+
+        Args:
+            instances: [{"name"?: str, "location"?: [X, Y, Z], "rotation"?: [P, Y, R], "scale"?: [X, Y, Z], "properties"?: {...}}]
+            actor_class: Actor class name or path (e.g. "StaticMeshActor", "/Game/BP_Tree.BP_Tree_C")
+            blueprint: Blueprint name or asset path, used when actor_class is empty
+            properties: Properties applied to every spawned actor before its construction script runs
+            folder: Optional outliner folder for the new actors
+            instanced: Put every instance into one InstancedStaticMeshComponent instead of spawning actors
+                (properties are rejected in this mode)
+            mesh: Static mesh asset path, required when instanced
+            name: Name of the container actor in instanced mode
+
+        Returns:
+            {"results": [...], "spawned", "failed"} or, when instanced, {"actor", "component", "instance_count", "failed"}.
+            spawned counts actors created; failed counts results with success=false, including actors that were
+            spawned but whose properties failed to apply
+        """
+        params: Dict[str, Any] = {"instances": instances}
+        if actor_class:
+            params["class"] = actor_class
+        elif blueprint:
+            params["blueprint"] = blueprint
+        if properties:
+            params["properties"] = properties
+        if folder:
+            params["folder"] = folder
+        if instanced:
+            params["mode"] = "instanced"
+            params["mesh"] = mesh
+            if name:
+                params["name"] = name
+        return call_cpp_tools(unreal.MCPEditorTools.handle_bulk_spawn_actors, params)
+
+    @mcp.domain_tool("level")
+    def snapshot_actors(ctx: Context, actors: Optional[List[str]] = None) -> Dict[str, Any]:
+        """
+        Save the current state of actors and their components in memory, to roll an experiment back in one step.
+
+        Args:
+            actors: Actor names or paths; defaults to the editor selection
+
+        Returns:
+            {"snapshot_id", "actors", "bytes", "snapshots"}; only the most recent snapshots are kept
+        """
+        params: Dict[str, Any] = {}
+        if actors:
+            params["actors"] = actors
+        return call_cpp_tools(unreal.MCPEditorTools.handle_snapshot_actors, params)
+
+    @mcp.domain_tool("level")
+    def restore_snapshot(ctx: Context, snapshot_id: str, discard: bool = False) -> Dict[str, Any]:
+        """
+        Restore actors and their components from a snapshot_actors snapshot, as one undoable transaction.
+
+        Args:
+            snapshot_id: Id returned by snapshot_actors
+            discard: Drop the snapshot after restoring it
+
+        Returns:
+            {"snapshot_id", "restored": [...], "missing": [paths of actors deleted since the snapshot]}
+        """
+        return call_cpp_tools(unreal.MCPEditorTools.handle_restore_snapshot, {"snapshot_id": snapshot_id, "discard": discard})
+
+    @mcp.domain_tool("level")
+    def find_actors_in_radius(
+        ctx: Context,
+        radius: float,
+        center: Optional[List[float]] = None,
+        actor: Optional[str] = None,
+        limit: int = 0,
+        cursor: str = "",
+        fields: str = "",
+    ) -> Dict[str, Any]:
+        """
+        Find actors whose bounds intersect a sphere, nearest first.
+
+        Args:
+            radius: Sphere radius in world units
+            center: [X, Y, Z] sphere center
+            actor: Name, label or path of an actor to center on instead (the actor itself is excluded)
+            limit / cursor / fields: Optional paging and field projection (fields may include "distance")
+
+        Returns:
+            {"actors": [...each with "distance"], "total", "next_cursor"?}
+        """
+        params: Dict[str, Any] = {"radius": radius}
+        if center is not None:
+            params["center"] = center
+        if actor:
+            params["actor"] = actor
+        return call_cpp_tools(unreal.MCPEditorTools.handle_find_actors_in_radius, page_params(params, limit, cursor, fields))
+
+    @mcp.domain_tool("level")
+    def find_actors_in_box(
+        ctx: Context,
+        box_min: List[float],
+        box_max: List[float],
+        fully_inside: bool = False,
+        limit: int = 0,
+        cursor: str = "",
+        fields: str = "",
+    ) -> Dict[str, Any]:
+        """
+        Find actors whose bounds intersect (or with fully_inside, lie inside) an axis-aligned box.
+
+        Args:
+            box_min: [X, Y, Z] box corner
+            box_max: [X, Y, Z] opposite box corner
+            fully_inside: Only return actors entirely inside the box
+            limit / cursor / fields: Optional paging and field projection
+        """
+        params = {"min": box_min, "max": box_max, "fully_inside": fully_inside}
+        return call_cpp_tools(unreal.MCPEditorTools.handle_find_actors_in_box, page_params(params, limit, cursor, fields))
+
+    @mcp.domain_tool("level")
+    def find_actors_in_view(
+        ctx: Context,
+        max_distance: float = 0.0,
+        limit: int = 0,
+        cursor: str = "",
+        fields: str = "",
+    ) -> Dict[str, Any]:
+        """
+        Find actors inside the view frustum of the active editor viewport, nearest to the camera first.
+
+        Args:
+            max_distance: Ignore actors farther than this from the camera (0 = no limit)
+            limit / cursor / fields: Optional paging and field projection
+        """
+        params = {"max_distance": max_distance}
+        return call_cpp_tools(unreal.MCPEditorTools.handle_find_actors_in_view_frustum, page_params(params, limit, cursor, fields))
+
+    @mcp.domain_tool("level")
+    def find_nearest_actors(
+        ctx: Context,
+        center: Optional[List[float]] = None,
+        actor: Optional[str] = None,
+        count: int = 10,
+        max_distance: float = 0.0,
+        fields: str = "",
+    ) -> Dict[str, Any]:
+        """
+        Find the actors nearest to a point or to another actor.
+
+        Args:
+            center: [X, Y, Z] query point
+            actor: Name, label or path of an actor to search around instead (the actor itself is excluded)
+            count: Number of actors to return
+            max_distance: Ignore actors farther than this (0 = no limit)
+            fields: Optional field projection (may include "distance")
+        """
+        params: Dict[str, Any] = {"count": count, "max_distance": max_distance}
+        if center is not None:
+            params["center"] = center
+        if actor:
+            params["actor"] = actor
+        return call_cpp_tools(unreal.MCPEditorTools.handle_find_nearest_actors, page_params(params, fields=fields))
     
     
     #region blueprint
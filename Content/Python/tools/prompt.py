@@ -55,7 +55,7 @@ print("World:", world.get_name() if world else None)
 
 - 查询：
   - `get_actors_in_level`：快速拿到当前关卡 Actor 列表
-  - `get_actors_detail_info`：按名称查看 Actor 及组件属性详情
+  - `get_actors_detail_info`：按名称查看 Actor 及组件属性详情（默认只返回非默认值，可用 paths 指定属性路径）
   - `get_actor_transform` / `get_actor_properties`：获取变换/属性
 - 变更（会改动场景，需用户明确同意）：
   - `spawn_actor` / `delete_actor`
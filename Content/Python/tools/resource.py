@@ -1,6 +1,7 @@
 
 from foundation.mcp_app import UnrealMCP
 import foundation.utility as utility
+import json
 import unreal
 
 def register_resource(mcp:UnrealMCP):
@@ -21,4 +22,11 @@ def register_resource(mcp:UnrealMCP):
     #         #     return file.read()
     #     except FileNotFoundError:
     #         return f"File not found: {path}"
-    pass
+
+    @mcp.resource("unreal://level/changes/{revision}", mime_type="application/json")
+    async def get_level_changes(revision: str) -> str:
+        """Actors added, modified and removed in the editor level since the given revision.
+        Read it with the "revision" of the last listing; the result carries the new revision to read next.
+        """
+        result = await utility.call_cpp_tools_async(unreal.MCPEditorTools.handle_get_actor_changes_since, {"revision": int(revision)})
+        return json.dumps(result)
@@ -42,7 +42,7 @@ slate_tools.py
 
 from typing import Any, Dict, List, Optional
 from foundation.mcp_app import UnrealMCP
-from foundation.utility import call_cpp_tools
+from foundation.utility import call_cpp_tools, page_params
 import unreal
 
 
@@ -150,6 +150,9 @@ def register_slate_tools(mcp: UnrealMCP):
         window_index: int = -1,
         window_title: str = "",
         max_depth: int = 8,
+        limit: int = 0,
+        cursor: str = "",
+        fields: str = "",
     ) -> Dict[str, Any]:
         """
         在 Slate Widget 树中按类型名称搜索匹配的 Widget。
@@ -164,11 +167,16 @@ def register_slate_tools(mcp: UnrealMCP):
             window_index: 限定搜索窗口（-1 表示搜索所有窗口）
             window_title: 按标题限定窗口（优先级低于 window_index）
             max_depth:    搜索深度上限（默认 8）
+            limit:        每页数量，0 表示全部
+            cursor:       上一页返回的 next_cursor
+            fields:       只返回这些字段，逗号分隔，如 "type,text"
 
         Returns:
             dict:
               searched_type - 查询的类型名
-              count         - 找到的数量
+              count         - 本页数量
+              total         - 找到的总数
+              next_cursor   - 还有下一页时返回
               widgets       - 列表，每项含 type/tag/text/depth/in_window/visibility
         """
         params: Dict[str, Any] = {
@@ -179,7 +187,7 @@ def register_slate_tools(mcp: UnrealMCP):
             params["window_index"] = window_index
         if window_title:
             params["window_title"] = window_title
-        return call_cpp_tools(unreal.MCPSlateTools.handle_find_widgets_by_type, params)
+        return call_cpp_tools(unreal.MCPSlateTools.handle_find_widgets_by_type, page_params(params, limit, cursor, fields))
 
     # ─────────────────────────────────────────────────────────────────────────
     # 交互工具（写入/模拟输入）
@@ -576,21 +584,28 @@ def register_slate_tools(mcp: UnrealMCP):
         )
 
     @mcp.domain_tool("slate", game_thread=True)
-    def slate_get_all_dock_tabs() -> Dict[str, Any]:
+    def slate_get_all_dock_tabs(limit: int = 0, cursor: str = "", fields: str = "") -> Dict[str, Any]:
         """
         遍历所有顶层窗口的 Widget 树，收集当前打开的所有 DockTab 信息。
 
+        Args:
+            limit:  每页数量，0 表示全部
+            cursor: 上一页返回的 next_cursor
+            fields: 只返回这些字段，逗号分隔，如 "label,in_window"
+
         Returns:
             dict:
               success - 是否成功
-              count   - Tab 总数
+              count   - 本页 Tab 数量
+              total   - Tab 总数
+              next_cursor - 还有下一页时返回
               tabs    - list of {label, role, is_foreground, in_window}
                 label        - Tab 显示标签文本
                 role         - Tab 角色 (MajorTab/PanelTab/DocumentTab/NomadTab)
                 is_foreground- 是否为前台激活 Tab
                 in_window    - 所在窗口标题
         """
-        return call_cpp_tools(unreal.MCPSlateTools.handle_get_all_dock_tabs, {})
+        return call_cpp_tools(unreal.MCPSlateTools.handle_get_all_dock_tabs, page_params({}, limit, cursor, fields))
 
     # ─────────────────────────────────────────────────────────────────────────
     # 滚动
@@ -4,6 +4,9 @@
 #include "MCPPythonBridge.h"
 #include "MCPMisc.h"
 #include "MCPUtility.h"
+#include "MCPTools/MCPToolRegistry.h"
+#include "MCPTools/MCPToolScheduler.h"
+#include "MCPTools/UnrealMCPCommonUtils.h"
 #include "Interfaces/IPluginManager.h"
 
 
@@ -50,11 +53,12 @@ FString UMCPPythonBridge::SafeCallCPPFunction(FMCPCommandDelegate Callable, cons
 	}
 	FJsonObjectParameter JsonObjectParameter{};
 	JsonObjectParameter.JsonObjectFromString(Parameter);
+	const EMCPJsonFormat Format = UMCPUtility::TakeResponseFormat(JsonObjectParameter);
 
 	try
 	{
 		FJsonObjectParameter Result = Callable.Execute(JsonObjectParameter);
-		return Result.ConvertToString();
+		return UMCPUtility::FormatResponse(Result, Format);
 	}
 	catch (...)
 	{
@@ -65,3 +69,91 @@ FString UMCPPythonBridge::SafeCallCPPFunction(FMCPCommandDelegate Callable, cons
 	}
 }
 
+FString UMCPPythonBridge::CallTool(const FString& Name, const FString& Parameter)
+{
+	FJsonObjectParameter JsonObjectParameter{};
+	JsonObjectParameter.JsonObjectFromString(Parameter);
+	const EMCPJsonFormat Format = UMCPUtility::TakeResponseFormat(JsonObjectParameter);
+
+	try
+	{
+		FJsonObjectParameter Result = FMCPToolRegistry::Get().CallTool(Name, JsonObjectParameter);
+		return UMCPUtility::FormatResponse(Result, Format);
+	}
+	catch (...)
+	{
+		return FString(TEXT("Exception with unknown"));
+	}
+}
+
+TArray<uint8> UMCPPythonBridge::CallToolUtf8(const FString& Name, const TArray<uint8>& Parameter)
+{
+	FJsonObjectParameter JsonObjectParameter{};
+	JsonObjectParameter.JsonObjectFromUtf8(Parameter);
+	const EMCPJsonFormat Format = UMCPUtility::TakeResponseFormat(JsonObjectParameter);
+
+	TArray<uint8> Bytes;
+	try
+	{
+		FJsonObjectParameter Result = FMCPToolRegistry::Get().CallTool(Name, JsonObjectParameter);
+		if (Format == EMCPJsonFormat::Compact)
+		{
+			Result.JsonObjectToUtf8(Bytes);
+		}
+		else
+		{
+			FJsonObjectParameter::FromSerializedString(UMCPUtility::FormatResponse(Result, Format)).JsonObjectToUtf8(Bytes);
+		}
+	}
+	catch (...)
+	{
+		FJsonObjectParameter Error = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Exception with unknown"));
+		Error.JsonObjectToUtf8(Bytes);
+	}
+	return Bytes;
+}
+
+FString UMCPPythonBridge::BatchCall(const FString& Parameter)
+{
+	FJsonObjectParameter JsonObjectParameter{};
+	JsonObjectParameter.JsonObjectFromString(Parameter);
+	const EMCPJsonFormat Format = UMCPUtility::TakeResponseFormat(JsonObjectParameter);
+
+	try
+	{
+		FJsonObjectParameter Result = FMCPToolRegistry::Get().CallBatch(JsonObjectParameter);
+		return UMCPUtility::FormatResponse(Result, Format);
+	}
+	catch (...)
+	{
+		return FString(TEXT("Exception with unknown"));
+	}
+}
+
+int64 UMCPPythonBridge::SubmitTool(const FString& Name, const FString& Parameter)
+{
+	return FMCPToolScheduler::Get().Submit(Name, Parameter);
+}
+
+FString UMCPPythonBridge::TryGetToolResult(int64 RequestId)
+{
+	FString Result;
+	FMCPToolScheduler::Get().TryTakeResult(RequestId, Result);
+	return Result;
+}
+
+FString UMCPPythonBridge::FormatJson(const FString& Json, EMCPJsonFormat Format)
+{
+	return UMCPUtility::FormatResponse(FJsonObjectParameter(Json), Format);
+}
+
+bool UMCPPythonBridge::HasTool(const FString& Name)
+{
+	return FMCPToolRegistry::Get().HasTool(Name);
+}
+
+TArray<FString> UMCPPythonBridge::ListTools()
+{
+	return FMCPToolRegistry::Get().GetToolNames();
+}
+
@@ -4,6 +4,8 @@
 #include "Async/Future.h"
 #include "IPythonScriptPlugin.h"
 #include "MCPSetting.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Misc/App.h"
 
 UMCPSubsystem* UMCPSubsystem::Instance = nullptr;
 
@@ -20,9 +22,9 @@ namespace
 
 void UMCPSubsystem::Tick(float DeltaTime)
 {
-	if (!MCPContext.IsRunning())
+	if (!IsServerRunning())
 	{
-		if (!MCPContext.GUID.IsEmpty() && !MCPContext.Bridge.IsBound())
+		if (!IsServerActive() && !MCPContext.GUID.IsEmpty() && !MCPContext.Bridge.IsBound())
 		{
 			SetupBridge();// 如果应该存在，则尝试重新构建
 		}
@@ -30,9 +32,19 @@ void UMCPSubsystem::Tick(float DeltaTime)
 	}
 
 	TickCount++;
+	const int32 TickInterval = IsEditorIdle() ? 1 : FMath::Max(1, GetDefault<UMCPSetting>()->TaskTickInterval);
 	if (TickCount % TickInterval == 0)
 	{
 		TickCount = TickCount % 86400;
+
+		// 没有新任务入队、也没有未完成的任务时，不进入 python
+		const uint32 QueuedSerial = QueuedTaskSerial.load(std::memory_order_acquire);
+		if (QueuedSerial == ServedTaskSerial && !bPendingWork)
+		{
+			return;
+		}
+		ServedTaskSerial = QueuedSerial;
+
 		try
 		{
 			bool Ret = MCPContext.Tick.IsBound() && MCPContext.Tick.Execute();
@@ -120,7 +132,7 @@ void UMCPSubsystem::ClearObject()
 void UMCPSubsystem::StartMCP()
 {
 	// StopMCP();
-	if (MCPContext.IsRunning())
+	if (IsServerActive())
 	{
 		UE_LOG(LogTemp, Error, TEXT("MCP Already Running"));
 		return;
@@ -130,6 +142,7 @@ void UMCPSubsystem::StartMCP()
 	SetupBridge();
 	if (MCPContext.Valid())
 	{
+		SetServerState(EMCPServerState::Starting);
 		RunTread = Async(EAsyncExecution::Thread, [this]()
 		{
 			// Your code to start the MCP goes here
@@ -149,7 +162,7 @@ void UMCPSubsystem::StartMCP()
 
 void UMCPSubsystem::Reload()
 {
-	if (MCPContext.IsRunning())
+	if (IsServerRunning())
 	{
 		bool Ret = MCPContext.Bridge.Execute(EMCPBridgeFuncType::Reload, TEXT("Reload"));
 	}
@@ -163,25 +176,77 @@ void UMCPSubsystem::StopMCP()
 		return;
 	}
 
-	if (!MCPContext.IsRunning())
+	if (!IsServerActive())
 	{
 		ClearObject();
 		return;
 	}
 	if (MCPContext.Bridge.IsBound())
 	{
+		SetServerState(EMCPServerState::Stopping);
 		auto _ = MCPContext.Bridge.Execute(EMCPBridgeFuncType::Exit, TEXT("MCP Stopped"));
 		RunTread.WaitFor(FTimespan::FromSeconds(100));
 	}
 
+	SetServerState(EMCPServerState::Stop);
 	ClearObject();
 }
 
 EMCPServerState UMCPSubsystem::GetMCPServeState() const
 {
-	if (MCPContext.Valid())
+	if (!MCPContext.Valid())
+	{
+		return EMCPServerState::Stop;
+	}
+	return static_cast<EMCPServerState>(ServerState.load(std::memory_order_acquire));
+}
+
+void UMCPSubsystem::SetServerState(EMCPServerState State)
+{
+	ServerState.store(static_cast<uint8>(State), std::memory_order_release);
+	if (State == EMCPServerState::Stop)
+	{
+		bPendingWork = false;
+	}
+}
+
+void UMCPSubsystem::NotifyTaskQueued()
+{
+	QueuedTaskSerial.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void UMCPSubsystem::SetPendingWork(bool bPending)
+{
+	bPendingWork = bPending;
+}
+
+float UMCPSubsystem::GetTaskBudgetMs() const
+{
+	const UMCPSetting* Setting = GetDefault<UMCPSetting>();
+	return IsEditorIdle() ? Setting->IdleTaskBudgetMs : Setting->TaskBudgetMs;
+}
+
+bool UMCPSubsystem::IsEditorIdle() const
+{
+	if (!FApp::HasFocus())
 	{
-		return EMCPServerState::Runing;
+		return true;
 	}
-	return EMCPServerState::Stop;
+	if (FSlateApplication::IsInitialized())
+	{
+		const double IdleSeconds = FPlatformTime::Seconds() - FSlateApplication::Get().GetLastUserInteractionTime();
+		return IdleSeconds >= GetDefault<UMCPSetting>()->IdleAfterSeconds;
+	}
+	return false;
+}
+
+bool UMCPSubsystem::IsServerActive() const
+{
+	const EMCPServerState State = GetMCPServeState();
+	return State == EMCPServerState::Starting || State == EMCPServerState::Runing || State == EMCPServerState::Stopping;
+}
+
+bool UMCPSubsystem::IsServerRunning() const
+{
+	return GetMCPServeState() == EMCPServerState::Runing;
 }
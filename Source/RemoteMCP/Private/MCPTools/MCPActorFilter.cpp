@@ -0,0 +1,278 @@
+#include "MCPTools/MCPActorFilter.h"
+
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "MCPTools/MCPActorIndex.h"
+#include "MCPTools/MCPSymbolIndex.h"
+#include "UObject/UnrealType.h"
+#include "WorldPartition/DataLayer/DataLayerInstance.h"
+
+bool FMCPActorFilter::ParseOp(const FString& Text, EOp& OutOp)
+{
+	static const TPair<const TCHAR*, EOp> Ops[] = {
+		{ TEXT("=="), EOp::Equal }, { TEXT("="), EOp::Equal }, { TEXT("eq"), EOp::Equal },
+		{ TEXT("!="), EOp::NotEqual }, { TEXT("ne"), EOp::NotEqual },
+		{ TEXT("<"), EOp::Less }, { TEXT("lt"), EOp::Less },
+		{ TEXT("<="), EOp::LessEqual }, { TEXT("le"), EOp::LessEqual },
+		{ TEXT(">"), EOp::Greater }, { TEXT("gt"), EOp::Greater },
+		{ TEXT(">="), EOp::GreaterEqual }, { TEXT("ge"), EOp::GreaterEqual },
+		{ TEXT("contains"), EOp::Contains },
+	};
+	for (const TPair<const TCHAR*, EOp>& Op : Ops)
+	{
+		if (Text.Equals(Op.Key, ESearchCase::IgnoreCase))
+		{
+			OutOp = Op.Value;
+			return true;
+		}
+	}
+	return false;
+}
+
+template<typename T>
+bool FMCPActorFilter::Compare(const T& A, const T& B, EOp Op)
+{
+	switch (Op)
+	{
+	case EOp::Equal: return A == B;
+	case EOp::NotEqual: return !(A == B);
+	case EOp::Less: return A < B;
+	case EOp::LessEqual: return !(B < A);
+	case EOp::Greater: return B < A;
+	case EOp::GreaterEqual: return !(A < B);
+	default: return false;
+	}
+}
+
+bool FMCPActorFilter::Parse(const FJsonObject& Params, FString& OutError)
+{
+	FString ClassName;
+	if (Params.TryGetStringField(TEXT("class"), ClassName) && !ClassName.IsEmpty())
+	{
+		Class = FMCPSymbolIndex::Get().FindClass(ClassName, AActor::StaticClass(), OutError);
+		if (!Class)
+		{
+			return false;
+		}
+	}
+	Params.TryGetBoolField(TEXT("include_subclasses"), bIncludeSubclasses);
+
+	const TArray<TSharedPtr<FJsonValue>>* TagArray = nullptr;
+	FString TagText;
+	if (Params.TryGetArrayField(TEXT("tags"), TagArray))
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *TagArray)
+		{
+			FString Tag;
+			if (Value.IsValid() && Value->TryGetString(Tag) && !Tag.IsEmpty())
+			{
+				Tags.AddUnique(FName(*Tag));
+			}
+		}
+	}
+	else if (Params.TryGetStringField(TEXT("tags"), TagText) && !TagText.IsEmpty())
+	{
+		Tags.Add(FName(*TagText));
+	}
+
+	FString TagMatch;
+	if (Params.TryGetStringField(TEXT("tag_match"), TagMatch))
+	{
+		bMatchAllTags = !TagMatch.Equals(TEXT("any"), ESearchCase::IgnoreCase);
+	}
+
+	Params.TryGetStringField(TEXT("folder"), Folder);
+	Folder.TrimCharInline(TEXT('/'), nullptr);
+	Params.TryGetStringField(TEXT("level"), Level);
+	Params.TryGetStringField(TEXT("data_layer"), DataLayer);
+	Params.TryGetStringField(TEXT("name_contains"), NameContains);
+
+	const TArray<TSharedPtr<FJsonValue>>* WhereArray = nullptr;
+	if (Params.TryGetArrayField(TEXT("where"), WhereArray))
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *WhereArray)
+		{
+			const TSharedPtr<FJsonObject>* Clause = nullptr;
+			FString PropertyName;
+			if (!Value.IsValid() || !Value->TryGetObject(Clause) || !(*Clause)->TryGetStringField(TEXT("property"), PropertyName))
+			{
+				OutError = TEXT("Each 'where' clause needs a 'property' field");
+				return false;
+			}
+
+			FPredicate& Predicate = Predicates.AddDefaulted_GetRef();
+			Predicate.Property = FName(*PropertyName);
+			Predicate.Value = (*Clause)->TryGetField(TEXT("value"));
+			if (!Predicate.Value.IsValid())
+			{
+				OutError = FString::Printf(TEXT("Missing 'value' in the 'where' clause on %s"), *PropertyName);
+				return false;
+			}
+
+			FString OpText = TEXT("==");
+			(*Clause)->TryGetStringField(TEXT("op"), OpText);
+			if (!ParseOp(OpText, Predicate.Op))
+			{
+				OutError = FString::Printf(TEXT("Unknown operator '%s' in the 'where' clause on %s"), *OpText, *PropertyName);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+void FMCPActorFilter::Gather(TArray<AActor*>& OutActors) const
+{
+	// narrow the candidates with the index where the filter allows it, then evaluate everything in one pass
+	FMCPActorIndex& Index = FMCPActorIndex::Get();
+	if (Class)
+	{
+		Index.FindByClass(Class, bIncludeSubclasses, OutActors);
+	}
+	else if (Tags.Num() > 0 && (bMatchAllTags || Tags.Num() == 1))
+	{
+		Index.FindByTag(Tags[0], OutActors);
+	}
+	else
+	{
+		Index.GetAllActors(OutActors);
+	}
+	OutActors.RemoveAll([this](AActor* Actor) { return !Matches(Actor); });
+}
+
+bool FMCPActorFilter::Matches(AActor* Actor) const
+{
+	if (!IsValid(Actor))
+	{
+		return false;
+	}
+
+	if (Class && !(bIncludeSubclasses ? Actor->IsA(Class) : Actor->GetClass() == Class))
+	{
+		return false;
+	}
+
+	if (Tags.Num() > 0)
+	{
+		const bool bTagMatch = bMatchAllTags
+			? !Tags.ContainsByPredicate([Actor](FName Tag) { return !Actor->Tags.Contains(Tag); })
+			: Tags.ContainsByPredicate([Actor](FName Tag) { return Actor->Tags.Contains(Tag); });
+		if (!bTagMatch)
+		{
+			return false;
+		}
+	}
+
+	if (!NameContains.IsEmpty() && !Actor->GetName().Contains(NameContains)
+#if WITH_EDITOR
+		&& !Actor->GetActorLabel().Contains(NameContains)
+#endif
+		)
+	{
+		return false;
+	}
+
+#if WITH_EDITOR
+	if (!Folder.IsEmpty())
+	{
+		const FString ActorFolder = Actor->GetFolderPath().ToString();
+		const bool bInFolder = ActorFolder.Equals(Folder, ESearchCase::IgnoreCase)
+			|| (ActorFolder.StartsWith(Folder, ESearchCase::IgnoreCase) && ActorFolder.Len() > Folder.Len() && ActorFolder[Folder.Len()] == TEXT('/'));
+		if (!bInFolder)
+		{
+			return false;
+		}
+	}
+
+	if (!DataLayer.IsEmpty())
+	{
+		const bool bInLayer = Actor->GetDataLayerInstances().ContainsByPredicate([this](const UDataLayerInstance* Instance)
+		{
+			return Instance && (Instance->GetDataLayerShortName().Equals(DataLayer, ESearchCase::IgnoreCase)
+				|| Instance->GetDataLayerFullName().Equals(DataLayer, ESearchCase::IgnoreCase));
+		});
+		if (!bInLayer)
+		{
+			return false;
+		}
+	}
+#endif
+
+	if (!Level.IsEmpty())
+	{
+		const ULevel* ActorLevel = Actor->GetLevel();
+		const UWorld* LevelWorld = ActorLevel ? ActorLevel->GetTypedOuter<UWorld>() : nullptr;
+		const FString PackageName = ActorLevel ? ActorLevel->GetOutermost()->GetName() : FString();
+		if (!(LevelWorld && LevelWorld->GetName().Equals(Level, ESearchCase::IgnoreCase)) && !PackageName.Equals(Level, ESearchCase::IgnoreCase))
+		{
+			return false;
+		}
+	}
+
+	for (const FPredicate& Predicate : Predicates)
+	{
+		if (!Evaluate(Predicate, Actor))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FMCPActorFilter::Evaluate(const FPredicate& Predicate, AActor* Actor) const
+{
+	FProperty* Property = nullptr;
+	if (FProperty** Cached = Predicate.PropertyCache.Find(Actor->GetClass()))
+	{
+		Property = *Cached;
+	}
+	else
+	{
+		Property = FindFProperty<FProperty>(Actor->GetClass(), Predicate.Property);
+		Predicate.PropertyCache.Add(Actor->GetClass(), Property);
+	}
+	if (!Property)
+	{
+		return false;
+	}
+
+	const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Actor);
+	const EOp Op = Predicate.Op;
+
+	if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	{
+		bool bExpected = false;
+		if (!Predicate.Value->TryGetBool(bExpected) || (Op != EOp::Equal && Op != EOp::NotEqual))
+		{
+			return false;
+		}
+		return Compare(BoolProperty->GetPropertyValue(ValuePtr), bExpected, Op);
+	}
+
+	const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+	double Expected = 0.0;
+	if (NumericProperty && !NumericProperty->IsEnum() && Op != EOp::Contains && Predicate.Value->TryGetNumber(Expected))
+	{
+		const double Actual = NumericProperty->IsFloatingPoint()
+			? NumericProperty->GetFloatingPointPropertyValue(ValuePtr)
+			: static_cast<double>(NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+		return Compare(Actual, Expected, Op);
+	}
+
+	// everything else (names, strings, enums, object references, structs) compares by its exported text
+	FString Actual;
+	Property->ExportTextItem_Direct(Actual, ValuePtr, nullptr, nullptr, PPF_None);
+	const FString ExpectedText = Predicate.Value->AsString();
+	switch (Op)
+	{
+	case EOp::Contains:
+		return Actual.Contains(ExpectedText);
+	case EOp::Equal:
+		return Actual.Equals(ExpectedText, ESearchCase::IgnoreCase);
+	case EOp::NotEqual:
+		return !Actual.Equals(ExpectedText, ESearchCase::IgnoreCase);
+	default:
+		return Compare(Actual.Compare(ExpectedText, ESearchCase::IgnoreCase), 0, Op);
+	}
+}
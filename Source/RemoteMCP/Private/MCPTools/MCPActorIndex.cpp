@@ -0,0 +1,348 @@
+#include "MCPTools/MCPActorIndex.h"
+
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+FMCPActorIndex& FMCPActorIndex::Get()
+{
+	static FMCPActorIndex Index;
+	return Index;
+}
+
+void FMCPActorIndex::Initialize()
+{
+	if (GEngine)
+	{
+		ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPActorIndex::OnLevelActorAdded);
+		ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPActorIndex::OnLevelActorDeleted);
+		// undo/redo, level streaming and other bulk edits only report "the list changed"
+		ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FMCPActorIndex::Invalidate);
+	}
+	LabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FMCPActorIndex::OnActorLabelChanged);
+	PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FMCPActorIndex::OnObjectPropertyChanged);
+	MapChangeHandle = FEditorDelegates::MapChange.AddLambda([this](uint32) { Invalidate(); });
+}
+
+void FMCPActorIndex::Shutdown()
+{
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+	}
+	FCoreDelegates::OnActorLabelChanged.Remove(LabelChangedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+	FEditorDelegates::MapChange.Remove(MapChangeHandle);
+
+	Invalidate();
+	World.Reset();
+}
+
+void FMCPActorIndex::Invalidate()
+{
+	bDirty = true;
+	Entries.Reset();
+	ByName.Reset();
+	ByPath.Reset();
+	ByLabel.Reset();
+	ByClass.Reset();
+	ByTag.Reset();
+}
+
+UWorld* FMCPActorIndex::GetIndexedWorld()
+{
+	// the tools operate on GWorld; switching to or from PIE changes it
+	return GWorld;
+}
+
+bool FMCPActorIndex::IsIndexable(const AActor* Actor) const
+{
+	return IsValid(Actor) && World.IsValid() && Actor->GetWorld() == World.Get();
+}
+
+void FMCPActorIndex::EnsureBuilt()
+{
+	UWorld* CurrentWorld = GetIndexedWorld();
+	if (!bDirty && World.Get() == CurrentWorld)
+	{
+		return;
+	}
+
+	Invalidate();
+	World = CurrentWorld;
+	if (CurrentWorld)
+	{
+		for (TActorIterator<AActor> It(CurrentWorld); It; ++It)
+		{
+			AddActor(*It);
+		}
+	}
+	bDirty = false;
+}
+
+void FMCPActorIndex::AddActor(AActor* Actor)
+{
+	if (!IsIndexable(Actor))
+	{
+		return;
+	}
+
+	const FObjectKey Key(Actor);
+	RemoveEntry(Key);
+
+	FEntry& Entry = Entries.Add(Key);
+	Entry.Actor = Actor;
+	Entry.Name = Actor->GetFName();
+	Entry.Path = Actor->GetPathName();
+	Entry.Class = Actor->GetClass();
+	Entry.Tags = Actor->Tags;
+#if WITH_EDITOR
+	Entry.Label = Actor->GetActorLabel();
+#endif
+
+	ByName.Add(Entry.Name, Key);
+	ByPath.Add(Entry.Path, Key);
+	if (!Entry.Label.IsEmpty())
+	{
+		ByLabel.Add(Entry.Label, Key);
+	}
+	ByClass.Add(Entry.Class, Key);
+	for (const FName& Tag : Entry.Tags)
+	{
+		ByTag.AddUnique(Tag, Key);
+	}
+}
+
+void FMCPActorIndex::RemoveEntry(const FObjectKey& Key)
+{
+	FEntry Entry;
+	if (!Entries.RemoveAndCopyValue(Key, Entry))
+	{
+		return;
+	}
+
+	ByName.RemoveSingle(Entry.Name, Key);
+	if (const FObjectKey* Found = ByPath.Find(Entry.Path); Found && *Found == Key)
+	{
+		ByPath.Remove(Entry.Path);
+	}
+	ByLabel.RemoveSingle(Entry.Label, Key);
+	ByClass.RemoveSingle(Entry.Class, Key);
+	for (const FName& Tag : Entry.Tags)
+	{
+		ByTag.RemoveSingle(Tag, Key);
+	}
+}
+
+void FMCPActorIndex::RemoveActor(AActor* Actor)
+{
+	RemoveEntry(FObjectKey(Actor));
+}
+
+void FMCPActorIndex::ReindexActor(AActor* Actor)
+{
+	if (bDirty || !Actor)
+	{
+		return;
+	}
+	RemoveActor(Actor);
+	AddActor(Actor);
+}
+
+void FMCPActorIndex::OnLevelActorAdded(AActor* Actor)
+{
+	if (!bDirty)
+	{
+		AddActor(Actor);
+	}
+}
+
+void FMCPActorIndex::OnLevelActorDeleted(AActor* Actor)
+{
+	if (!bDirty)
+	{
+		RemoveActor(Actor);
+	}
+}
+
+void FMCPActorIndex::OnActorLabelChanged(AActor* Actor)
+{
+	ReindexActor(Actor);
+}
+
+void FMCPActorIndex::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+	AActor* Actor = Cast<AActor>(Object);
+	if (Actor && Event.GetPropertyName() == GET_MEMBER_NAME_CHECKED(AActor, Tags))
+	{
+		ReindexActor(Actor);
+	}
+}
+
+AActor* FMCPActorIndex::FindByName(FName Name)
+{
+	EnsureBuilt();
+	AActor* Best = nullptr;
+	const FEntry* BestEntry = nullptr;
+	TArray<FObjectKey, TInlineAllocator<2>> Stale;
+	for (auto It = ByName.CreateConstKeyIterator(Name); It; ++It)
+	{
+		const FEntry& Entry = Entries.FindChecked(It.Value());
+		AActor* Actor = Entry.Actor.Get();
+		if (!IsValid(Actor) || Actor->GetFName() != Name)
+		{
+			// renamed or destroyed without a notification
+			Stale.Add(It.Value());
+			continue;
+		}
+		const bool bPersistent = Actor->GetLevel() && Actor->GetLevel()->IsPersistentLevel();
+		const bool bBestPersistent = Best && Best->GetLevel() && Best->GetLevel()->IsPersistentLevel();
+		if (!Best || (bPersistent && !bBestPersistent)
+			|| (bPersistent == bBestPersistent && Entry.Path.Compare(BestEntry->Path, ESearchCase::CaseSensitive) < 0))
+		{
+			Best = Actor;
+			BestEntry = &Entry;
+		}
+	}
+	for (const FObjectKey& Key : Stale)
+	{
+		const TWeakObjectPtr<AActor> Actor = Entries.FindChecked(Key).Actor;
+		RemoveEntry(Key);
+		AddActor(Actor.Get());
+	}
+	if (Best)
+	{
+		return Best;
+	}
+
+	// object renames are not broadcast; the object hash of each level answers a miss without a world sweep
+	if (UWorld* CurrentWorld = World.Get())
+	{
+		for (ULevel* Level : CurrentWorld->GetLevels())
+		{
+			if (AActor* Actor = Level ? FindObjectFast<AActor>(Level, Name) : nullptr; IsIndexable(Actor))
+			{
+				ReindexActor(Actor);
+				return Actor;
+			}
+		}
+	}
+	return nullptr;
+}
+
+AActor* FMCPActorIndex::FindByPath(const FString& Path)
+{
+	EnsureBuilt();
+	if (const FObjectKey* Key = ByPath.Find(Path))
+	{
+		AActor* Actor = Entries.FindChecked(*Key).Actor.Get();
+		if (IsValid(Actor) && Actor->GetPathName() == Path)
+		{
+			return Actor;
+		}
+	}
+	return nullptr;
+}
+
+AActor* FMCPActorIndex::FindByLabel(const FString& Label)
+{
+	EnsureBuilt();
+	if (const FObjectKey* Key = ByLabel.Find(Label))
+	{
+		AActor* Actor = Entries.FindChecked(*Key).Actor.Get();
+		if (IsValid(Actor))
+		{
+			return Actor;
+		}
+	}
+	return nullptr;
+}
+
+AActor* FMCPActorIndex::FindActor(const FString& Identifier)
+{
+	if (Identifier.IsEmpty())
+	{
+		return nullptr;
+	}
+	// FNAME_Find: a name that was never created cannot belong to an actor
+	if (const FName Name(*Identifier, FNAME_Find); !Name.IsNone())
+	{
+		if (AActor* Actor = FindByName(Name))
+		{
+			return Actor;
+		}
+	}
+	if (AActor* Actor = FindByPath(Identifier))
+	{
+		return Actor;
+	}
+	return FindByLabel(Identifier);
+}
+
+void FMCPActorIndex::FindByClass(const UClass* Class, bool bIncludeSubclasses, TArray<AActor*>& OutActors)
+{
+	EnsureBuilt();
+	if (!Class)
+	{
+		return;
+	}
+
+	auto Collect = [this, &OutActors](const UClass* ExactClass)
+	{
+		for (auto It = ByClass.CreateConstKeyIterator(ExactClass); It; ++It)
+		{
+			if (AActor* Actor = Entries.FindChecked(It.Value()).Actor.Get(); IsValid(Actor))
+			{
+				OutActors.Add(Actor);
+			}
+		}
+	};
+
+	if (!bIncludeSubclasses)
+	{
+		Collect(Class);
+		return;
+	}
+
+	TArray<const UClass*> Classes;
+	ByClass.GetKeys(Classes);
+	for (const UClass* IndexedClass : Classes)
+	{
+		if (IndexedClass->IsChildOf(Class))
+		{
+			Collect(IndexedClass);
+		}
+	}
+}
+
+void FMCPActorIndex::FindByTag(FName Tag, TArray<AActor*>& OutActors)
+{
+	EnsureBuilt();
+	for (auto It = ByTag.CreateConstKeyIterator(Tag); It; ++It)
+	{
+		if (AActor* Actor = Entries.FindChecked(It.Value()).Actor.Get(); IsValid(Actor) && Actor->Tags.Contains(Tag))
+		{
+			OutActors.Add(Actor);
+		}
+	}
+}
+
+void FMCPActorIndex::GetAllActors(TArray<AActor*>& OutActors)
+{
+	EnsureBuilt();
+	OutActors.Reserve(OutActors.Num() + Entries.Num());
+	for (const TPair<FObjectKey, FEntry>& Pair : Entries)
+	{
+		if (AActor* Actor = Pair.Value.Actor.Get(); IsValid(Actor))
+		{
+			OutActors.Add(Actor);
+		}
+	}
+}
@@ -8,6 +8,8 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "EditorAssetLibrary.h"
 #include "BehaviorTreeFactory.h"
+#include "MCPTools/MCPGraphIndex.h"
+#include "MCPTools/MCPSymbolIndex.h"
 #include "MCPTools/UnrealMCPCommonUtils.h"
 #include "Dom/JsonObject.h"
 #include "AIGraphNode.h"
@@ -231,25 +233,6 @@ FJsonObjectParameter UMCPBehaviorTreeTools::HandleListBTGraphNodes(const FJsonOb
 	return FUnrealMCPCommonUtils::CreateSuccessResponse(ResultObj);
 }
 
-static UClass* _ResolveBTNodeClass(const FString& InClassStr)
-{
-	// AI(GPT-5.2): 支持 "/Script/AIModule.BTTask_Wait" 或 "BTTask_Wait"
-	UClass* Cls = nullptr;
-	if (InClassStr.IsEmpty())
-	{
-		return nullptr;
-	}
-	// 尝试 LoadClass（可处理 /Script 路径）
-	Cls = LoadClass<UObject>(nullptr, *InClassStr);
-	if (Cls)
-	{
-		return Cls;
-	}
-	// 尝试在已加载类中按名字查找
-	Cls = FindFirstObject<UClass>(*InClassStr, EFindFirstObjectOptions::None);
-	return Cls;
-}
-
 FJsonObjectParameter UMCPBehaviorTreeTools::HandleAddBTGraphNode(const FJsonObjectParameter& Params)
 {
 	// AI(GPT-5.2): 在 BT Graph 内创建 Task/Composite 节点（通过 ClassData + PostPlacedNewNode 生成 NodeInstance）
@@ -287,10 +270,12 @@ FJsonObjectParameter UMCPBehaviorTreeTools::HandleAddBTGraphNode(const FJsonObje
 		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("BehaviorTreeGraph not found: %s"), *GraphPath));
 	}
 
-	UClass* BTNodeClass = _ResolveBTNodeClass(BTNodeClassStr);
+	// 支持 "/Script/AIModule.BTTask_Wait"、"BTTask_Wait" 或 "Wait"
+	FString ClassError;
+	UClass* BTNodeClass = FMCPSymbolIndex::Get().FindClass(BTNodeClassStr, UBTNode::StaticClass(), ClassError);
 	if (!BTNodeClass)
 	{
-		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("BT node class not found: %s"), *BTNodeClassStr));
+		return FUnrealMCPCommonUtils::CreateErrorResponse(ClassError);
 	}
 
 	UBehaviorTreeGraphNode* NewNode = nullptr;
@@ -368,8 +353,8 @@ FJsonObjectParameter UMCPBehaviorTreeTools::HandleConnectBTGraphNodes(const FJso
 		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("BehaviorTreeGraph not found: %s"), *GraphPath));
 	}
 
-	UAIGraphNode* ParentNode = LoadObject<UAIGraphNode>(nullptr, *ParentNodePath);
-	UAIGraphNode* ChildNode = LoadObject<UAIGraphNode>(nullptr, *ChildNodePath);
+	UAIGraphNode* ParentNode = Cast<UAIGraphNode>(FMCPGraphIndex::Get().FindNodeByPath(ParentNodePath, Graph));
+	UAIGraphNode* ChildNode = Cast<UAIGraphNode>(FMCPGraphIndex::Get().FindNodeByPath(ChildNodePath, Graph));
 	if (!ParentNode || !ChildNode)
 	{
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Parent/Child node not found"));
@@ -480,7 +465,7 @@ FJsonObjectParameter UMCPBehaviorTreeTools::HandleGetBTAuxiliaryNodes(const FJso
                 return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'wait_time' parameter"));
             }
 
-            UBehaviorTreeGraphNode_Task* TaskGraphNode = LoadObject<UBehaviorTreeGraphNode_Task>(nullptr, *NodePath);
+            UBehaviorTreeGraphNode_Task* TaskGraphNode = Cast<UBehaviorTreeGraphNode_Task>(FMCPGraphIndex::Get().FindNodeByPath(NodePath));
             if (!TaskGraphNode)
             {
                 return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Node not found or not a BT Task Graph Node"));
@@ -539,7 +524,7 @@ FJsonObjectParameter UMCPBehaviorTreeTools::HandleGetBTAuxiliaryNodes(const FJso
 				}
 			}
 
-			UBehaviorTreeGraphNode* ParentNode = LoadObject<UBehaviorTreeGraphNode>(nullptr, *ParentNodePath);
+			UBehaviorTreeGraphNode* ParentNode = Cast<UBehaviorTreeGraphNode>(FMCPGraphIndex::Get().FindNodeByPath(ParentNodePath));
 			if (!ParentNode)
 			{
 				return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Parent node not found: %s"), *ParentNodePath));
@@ -551,14 +536,11 @@ FJsonObjectParameter UMCPBehaviorTreeTools::HandleGetBTAuxiliaryNodes(const FJso
 				return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Parent node has no BehaviorTreeGraph"));
 			}
 
-			UClass* ServiceClass = _ResolveBTNodeClass(ServiceClassStr);
+			FString ClassError;
+			UClass* ServiceClass = FMCPSymbolIndex::Get().FindClass(ServiceClassStr, UBTService::StaticClass(), ClassError);
 			if (!ServiceClass)
 			{
-				return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Service class not found: %s"), *ServiceClassStr));
-			}
-			if (!ServiceClass->IsChildOf(UBTService::StaticClass()))
-			{
-				return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("service_class must be a UBTService subclass"));
+				return FUnrealMCPCommonUtils::CreateErrorResponse(ClassError);
 			}
 
 			Graph->Modify();
@@ -614,7 +596,7 @@ FJsonObjectParameter UMCPBehaviorTreeTools::HandleGetBTAuxiliaryNodes(const FJso
 				return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'service_node_path' parameter"));
 			}
 
-			UBehaviorTreeGraphNode* ParentNode = LoadObject<UBehaviorTreeGraphNode>(nullptr, *ParentNodePath);
+			UBehaviorTreeGraphNode* ParentNode = Cast<UBehaviorTreeGraphNode>(FMCPGraphIndex::Get().FindNodeByPath(ParentNodePath));
 			if (!ParentNode)
 			{
 				return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Parent node not found: %s"), *ParentNodePath));
@@ -666,7 +648,7 @@ FJsonObjectParameter UMCPBehaviorTreeTools::HandleGetBTAuxiliaryNodes(const FJso
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'node_path' parameter"));
     }
 
-    UBehaviorTreeGraphNode* GraphNode = LoadObject<UBehaviorTreeGraphNode>(nullptr, *NodePath);
+    UBehaviorTreeGraphNode* GraphNode = Cast<UBehaviorTreeGraphNode>(FMCPGraphIndex::Get().FindNodeByPath(NodePath));
     if (!GraphNode)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Node not found or not a BT Graph Node"));
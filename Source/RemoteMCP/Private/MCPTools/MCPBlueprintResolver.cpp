@@ -0,0 +1,220 @@
+#include "MCPTools/MCPBlueprintResolver.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "Misc/PackageName.h"
+
+namespace MCPBlueprintResolver
+{
+	/** The Blueprint type of an asset, or null when it is not a Blueprint (or its type is not loaded). */
+	static const UClass* GetBlueprintClass(const FAssetData& Asset)
+	{
+		const UClass* AssetClass = FindObject<UClass>(Asset.AssetClassPath);
+		return AssetClass && AssetClass->IsChildOf(UBlueprint::StaticClass()) ? AssetClass : nullptr;
+	}
+
+	static bool Matches(const UClass* AssetClass, const UClass* BlueprintClass)
+	{
+		if (!BlueprintClass || BlueprintClass == UBlueprint::StaticClass())
+		{
+			return true;
+		}
+		return AssetClass && AssetClass->IsChildOf(BlueprintClass);
+	}
+
+	static FString Describe(const UClass* BlueprintClass)
+	{
+		return BlueprintClass && BlueprintClass != UBlueprint::StaticClass() ? BlueprintClass->GetName() : TEXT("Blueprint");
+	}
+}
+
+FMCPBlueprintResolver& FMCPBlueprintResolver::Get()
+{
+	static FMCPBlueprintResolver Resolver;
+	return Resolver;
+}
+
+void FMCPBlueprintResolver::Initialize()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FMCPBlueprintResolver::OnAssetAdded);
+	RemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FMCPBlueprintResolver::OnAssetRemoved);
+	RenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FMCPBlueprintResolver::OnAssetRenamed);
+}
+
+void FMCPBlueprintResolver::Shutdown()
+{
+	if (FAssetRegistryModule* Module = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+	{
+		IAssetRegistry& AssetRegistry = Module->Get();
+		AssetRegistry.OnAssetAdded().Remove(AddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(RemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(RenamedHandle);
+	}
+	Reset();
+}
+
+UBlueprint* FMCPBlueprintResolver::Resolve(const FString& Name, FString& OutError, const UClass* BlueprintClass)
+{
+	if (Name.StartsWith(TEXT("/")))
+	{
+		// a package path names its asset after the last segment
+		const FString ObjectPath = Name.Contains(TEXT(".")) ? Name : Name + TEXT(".") + FPackageName::GetShortName(Name);
+		if (UBlueprint* Blueprint = Load(FSoftObjectPath(ObjectPath), BlueprintClass))
+		{
+			return Blueprint;
+		}
+		OutError = FString::Printf(TEXT("%s not found: %s"), *MCPBlueprintResolver::Describe(BlueprintClass), *Name);
+		return nullptr;
+	}
+
+	if (!bIndexed)
+	{
+		BuildIndex();
+	}
+
+	TArray<const FEntry*, TInlineAllocator<4>> Candidates;
+	// FNAME_Find: a name nobody has registered cannot be an asset, and typos should not grow the name table
+	const FName AssetName(*Name, FNAME_Find);
+	if (!AssetName.IsNone())
+	{
+		for (auto It = ByName.CreateConstKeyIterator(AssetName); It; ++It)
+		{
+			if (MCPBlueprintResolver::Matches(It.Value().AssetClass, BlueprintClass))
+			{
+				Candidates.Add(&It.Value());
+			}
+		}
+	}
+
+	if (Candidates.Num() == 1)
+	{
+		if (UBlueprint* Blueprint = Load(Candidates[0]->Path, BlueprintClass))
+		{
+			return Blueprint;
+		}
+		OutError = FString::Printf(TEXT("%s failed to load: %s"), *MCPBlueprintResolver::Describe(BlueprintClass), *Candidates[0]->Path.ToString());
+		return nullptr;
+	}
+
+	if (Candidates.IsEmpty())
+	{
+		const bool bScanning = FAssetRegistryModule::GetRegistry().IsLoadingAssets();
+		OutError = FString::Printf(TEXT("%s not found: %s%s"), *MCPBlueprintResolver::Describe(BlueprintClass), *Name,
+			bScanning ? TEXT(" (the asset registry is still scanning, try again shortly)") : TEXT(""));
+		return nullptr;
+	}
+
+	TArray<FString> Paths;
+	for (const FEntry* Candidate : Candidates)
+	{
+		Paths.Add(Candidate->Path.GetLongPackageName());
+	}
+	Paths.Sort();
+	OutError = FString::Printf(TEXT("%s name '%s' is ambiguous, pass one of these paths instead: %s"),
+		*MCPBlueprintResolver::Describe(BlueprintClass), *Name, *FString::Join(Paths, TEXT(", ")));
+	return nullptr;
+}
+
+void FMCPBlueprintResolver::Reset()
+{
+	ByName.Reset();
+	Loaded.Reset();
+	bIndexed = false;
+}
+
+void FMCPBlueprintResolver::BuildIndex()
+{
+	TArray<FAssetData> Assets;
+	FAssetRegistryModule::GetRegistry().GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), Assets, true);
+
+	ByName.Reset();
+	for (const FAssetData& Asset : Assets)
+	{
+		AddAsset(Asset, MCPBlueprintResolver::GetBlueprintClass(Asset));
+	}
+	// assets discovered from here on (including the rest of an initial scan) arrive through OnAssetAdded
+	bIndexed = true;
+}
+
+void FMCPBlueprintResolver::AddAsset(const FAssetData& Asset, const UClass* AssetClass)
+{
+	const FSoftObjectPath Path = Asset.GetSoftObjectPath();
+	for (auto It = ByName.CreateKeyIterator(Asset.AssetName); It; ++It)
+	{
+		// a rescan of a known asset must not turn its name ambiguous
+		if (It.Value().Path == Path)
+		{
+			It.Value().AssetClass = AssetClass;
+			return;
+		}
+	}
+	FEntry& Entry = ByName.Add(Asset.AssetName);
+	Entry.Path = Path;
+	Entry.AssetClass = AssetClass;
+}
+
+void FMCPBlueprintResolver::RemoveAsset(FName Name, const FSoftObjectPath& Path)
+{
+	for (auto It = ByName.CreateKeyIterator(Name); It; ++It)
+	{
+		if (It.Value().Path == Path)
+		{
+			It.RemoveCurrent();
+		}
+	}
+	Loaded.Remove(Path);
+}
+
+UBlueprint* FMCPBlueprintResolver::Load(const FSoftObjectPath& Path, const UClass* BlueprintClass)
+{
+	UBlueprint* Blueprint = nullptr;
+	if (const TWeakObjectPtr<UBlueprint>* Cached = Loaded.Find(Path))
+	{
+		Blueprint = Cached->Get();
+	}
+	if (!Blueprint)
+	{
+		Blueprint = Cast<UBlueprint>(Path.TryLoad());
+		if (!Blueprint)
+		{
+			return nullptr;
+		}
+		Loaded.Add(Path, Blueprint);
+	}
+	return !BlueprintClass || Blueprint->IsA(BlueprintClass) ? Blueprint : nullptr;
+}
+
+void FMCPBlueprintResolver::OnAssetAdded(const FAssetData& Asset)
+{
+	if (!bIndexed)
+	{
+		return;
+	}
+	if (const UClass* AssetClass = MCPBlueprintResolver::GetBlueprintClass(Asset))
+	{
+		AddAsset(Asset, AssetClass);
+	}
+}
+
+void FMCPBlueprintResolver::OnAssetRemoved(const FAssetData& Asset)
+{
+	if (bIndexed)
+	{
+		RemoveAsset(Asset.AssetName, Asset.GetSoftObjectPath());
+	}
+}
+
+void FMCPBlueprintResolver::OnAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath)
+{
+	if (!bIndexed)
+	{
+		return;
+	}
+	const FSoftObjectPath OldPath(OldObjectPath);
+	RemoveAsset(FName(*OldPath.GetAssetName()), OldPath);
+	if (const UClass* AssetClass = MCPBlueprintResolver::GetBlueprintClass(Asset))
+	{
+		AddAsset(Asset, AssetClass);
+	}
+}
@@ -16,12 +16,11 @@
 #include "Factories/BlueprintFactory.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
+#include "MCPTools/MCPPropertyPath.h"
+#include "MCPTools/MCPSymbolIndex.h"
 #include "MCPTools/UnrealMCPCommonUtils.h"
 
 
-#define  _ANY_PACKAGE nullptr
-
-
 auto DefaultPackagePathRoot = TEXT("/Game/Blueprints/");
 FJsonObjectParameter UMCPBlueprintTools::HandleCreateBlueprint(const FJsonObjectParameter& Params)
 {
@@ -145,10 +144,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleAddComponentToBlueprint(const FJs
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Create the component - dynamically find the component class by name
@@ -270,11 +270,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleSetComponentProperty(const FJsonO
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Blueprint not found: %s"), *BlueprintName);
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
     else
     {
@@ -330,366 +330,27 @@ FJsonObjectParameter UMCPBlueprintTools::HandleSetComponentProperty(const FJsonO
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Invalid component template"));
     }
 
-    // Check if this is a Spring Arm component and log special debug info
-    if (ComponentTemplate->GetClass()->GetName().Contains(TEXT("SpringArm")))
-    {
-        UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - SpringArm component detected! Class: %s"), 
-            *ComponentTemplate->GetClass()->GetPathName());
-            
-        // Log all properties of the SpringArm component class
-        UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - SpringArm properties:"));
-        for (TFieldIterator<FProperty> PropIt(ComponentTemplate->GetClass()); PropIt; ++PropIt)
-        {
-            FProperty* Prop = *PropIt;
-            UE_LOG(LogTemp, Warning, TEXT("  - %s (%s)"), *Prop->GetName(), *Prop->GetCPPType());
-        }
-
-        // Special handling for Spring Arm properties
-        if (Params->HasField(TEXT("property_value")))
-        {
-            TSharedPtr<FJsonValue> JsonValue = Params->Values.FindRef(TEXT("property_value"));
-            
-            // Get the property using the new FField system
-            FProperty* Property = FindFProperty<FProperty>(ComponentTemplate->GetClass(), *PropertyName);
-            if (!Property)
-            {
-                UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Property %s not found on SpringArm component"), *PropertyName);
-                return FUnrealMCPCommonUtils::CreateErrorResponse(
-                    FString::Printf(TEXT("Property %s not found on SpringArm component"), *PropertyName));
-            }
-
-            // Create a scope guard to ensure property cleanup
-            struct FScopeGuard
-            {
-                UObject* Object;
-                FScopeGuard(UObject* InObject) : Object(InObject) 
-                {
-                    if (Object)
-                    {
-                        Object->Modify();
-                    }
-                }
-                ~FScopeGuard()
-                {
-                    if (Object)
-                    {
-                        Object->PostEditChange();
-                    }
-                }
-            } ScopeGuard(ComponentTemplate);
-
-            bool bSuccess = false;
-            FString ErrorMessage;
-
-            // Handle specific Spring Arm property types
-            if (FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
-            {
-                if (JsonValue->Type == EJson::Number)
-                {
-                    const float Value = JsonValue->AsNumber();
-                    UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Setting float property %s to %f"), *PropertyName, Value);
-                    FloatProp->SetPropertyValue_InContainer(ComponentTemplate, Value);
-                    bSuccess = true;
-                }
-            }
-            else if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
-            {
-                if (JsonValue->Type == EJson::Boolean)
-                {
-                    const bool Value = JsonValue->AsBool();
-                    UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Setting bool property %s to %d"), *PropertyName, Value);
-                    BoolProp->SetPropertyValue_InContainer(ComponentTemplate, Value);
-                    bSuccess = true;
-                }
-            }
-            else if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
-            {
-                UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Handling struct property %s of type %s"), 
-                    *PropertyName, *StructProp->Struct->GetName());
-                
-                // Special handling for common Spring Arm struct properties
-                if (StructProp->Struct == TBaseStructure<FVector>::Get())
-                {
-                    if (JsonValue->Type == EJson::Array)
-                    {
-                        const TArray<TSharedPtr<FJsonValue>>& Arr = JsonValue->AsArray();
-                        if (Arr.Num() == 3)
-                        {
-                            FVector Vec(
-                                Arr[0]->AsNumber(),
-                                Arr[1]->AsNumber(),
-                                Arr[2]->AsNumber()
-                            );
-                            void* PropertyAddr = StructProp->ContainerPtrToValuePtr<void>(ComponentTemplate);
-                            StructProp->CopySingleValue(PropertyAddr, &Vec);
-                            bSuccess = true;
-                        }
-                    }
-                }
-                else if (StructProp->Struct == TBaseStructure<FRotator>::Get())
-                {
-                    if (JsonValue->Type == EJson::Array)
-                    {
-                        const TArray<TSharedPtr<FJsonValue>>& Arr = JsonValue->AsArray();
-                        if (Arr.Num() == 3)
-                        {
-                            FRotator Rot(
-                                Arr[0]->AsNumber(),
-                                Arr[1]->AsNumber(),
-                                Arr[2]->AsNumber()
-                            );
-                            void* PropertyAddr = StructProp->ContainerPtrToValuePtr<void>(ComponentTemplate);
-                            StructProp->CopySingleValue(PropertyAddr, &Rot);
-                            bSuccess = true;
-                        }
-                    }
-                }
-            }
-
-            if (bSuccess)
-            {
-                // Mark the blueprint as modified
-                UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Successfully set SpringArm property %s"), *PropertyName);
-                FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-
-                FJsonObjectParameter ResultObj = MakeShared<FJsonObject>();
-                ResultObj->SetStringField(TEXT("component"), ComponentName);
-                ResultObj->SetStringField(TEXT("property"), PropertyName);
-                ResultObj->SetBoolField(TEXT("success"), true);
-                return ResultObj;
-            }
-            else
-            {
-                UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Failed to set SpringArm property %s"), *PropertyName);
-                return FUnrealMCPCommonUtils::CreateErrorResponse(
-                    FString::Printf(TEXT("Failed to set SpringArm property %s"), *PropertyName));
-            }
-        }
-    }
-
-    // Regular property handling for non-Spring Arm components continues...
-
     // Set the property value
     if (Params->HasField(TEXT("property_value")))
     {
         TSharedPtr<FJsonValue> JsonValue = Params->Values.FindRef(TEXT("property_value"));
-        
-        // Get the property
-        FProperty* Property = FindFProperty<FProperty>(ComponentTemplate->GetClass(), *PropertyName);
-        if (!Property)
-        {
-            UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Property %s not found on component %s"), 
-                *PropertyName, *ComponentName);
-            
-            // List all available properties for this component
-            UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - Available properties for %s:"), *ComponentName);
-            for (TFieldIterator<FProperty> PropIt(ComponentTemplate->GetClass()); PropIt; ++PropIt)
-            {
-                FProperty* Prop = *PropIt;
-                UE_LOG(LogTemp, Warning, TEXT("  - %s (%s)"), *Prop->GetName(), *Prop->GetCPPType());
-            }
-            
-            return FUnrealMCPCommonUtils::CreateErrorResponse(
-                FString::Printf(TEXT("Property %s not found on component %s"), *PropertyName, *ComponentName));
-        }
-        else
-        {
-            UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Property found: %s (Type: %s)"), 
-                *PropertyName, *Property->GetCPPType());
-        }
 
-        bool bSuccess = false;
+        // The name may be a nested path ("BodyInstance.MassScale"); compiled paths are cached per class
         FString ErrorMessage;
-
-        // Handle different property types
-        UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Attempting to set property %s"), *PropertyName);
-        
-        // Add try-catch block to catch and log any crashes
-        try
+        const FMCPPropertyPath* Path = FMCPPropertyPathCache::Get().Find(ComponentTemplate->GetClass(), PropertyName, ErrorMessage);
+        if (!Path)
         {
-            if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
-            {
-                // Handle vector properties
-                UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Property is a struct: %s"), 
-                    StructProp->Struct ? *StructProp->Struct->GetName() : TEXT("NULL"));
-                    
-                if (StructProp->Struct == TBaseStructure<FVector>::Get())
-                {
-                    if (JsonValue->Type == EJson::Array)
-                    {
-                        // Handle array input [x, y, z]
-                        const TArray<TSharedPtr<FJsonValue>>& Arr = JsonValue->AsArray();
-                        if (Arr.Num() == 3)
-                        {
-                            FVector Vec(
-                                Arr[0]->AsNumber(),
-                                Arr[1]->AsNumber(),
-                                Arr[2]->AsNumber()
-                            );
-                            void* PropertyAddr = StructProp->ContainerPtrToValuePtr<void>(ComponentTemplate);
-                            UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Setting Vector(%f, %f, %f)"), 
-                                Vec.X, Vec.Y, Vec.Z);
-                            StructProp->CopySingleValue(PropertyAddr, &Vec);
-                            bSuccess = true;
-                        }
-                        else
-                        {
-                            ErrorMessage = FString::Printf(TEXT("Vector property requires 3 values, got %d"), Arr.Num());
-                            UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s"), *ErrorMessage);
-                        }
-                    }
-                    else if (JsonValue->Type == EJson::Number)
-                    {
-                        // Handle scalar input (sets all components to same value)
-                        float Value = JsonValue->AsNumber();
-                        FVector Vec(Value, Value, Value);
-                        void* PropertyAddr = StructProp->ContainerPtrToValuePtr<void>(ComponentTemplate);
-                        UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Setting Vector(%f, %f, %f) from scalar"), 
-                            Vec.X, Vec.Y, Vec.Z);
-                        StructProp->CopySingleValue(PropertyAddr, &Vec);
-                        bSuccess = true;
-                    }
-                    else
-                    {
-                        ErrorMessage = TEXT("Vector property requires either a single number or array of 3 numbers");
-                        UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s"), *ErrorMessage);
-                    }
-                }
-                else
-                {
-                    // Handle other struct properties using default handler
-                    UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Using generic struct handler for %s"), 
-                        *PropertyName);
-                    bSuccess = FUnrealMCPCommonUtils::SetObjectProperty(ComponentTemplate, PropertyName, JsonValue, ErrorMessage);
-                    if (!bSuccess)
-                    {
-                        UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Failed to set struct property: %s"), *ErrorMessage);
-                    }
-                }
-            }
-            else if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
-            {
-                // Handle enum properties
-                UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Property is an enum"));
-                if (JsonValue->Type == EJson::String)
-                {
-                    FString EnumValueName = JsonValue->AsString();
-                    UEnum* Enum = EnumProp->GetEnum();
-                    UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Setting enum from string: %s"), *EnumValueName);
-                    
-                    if (Enum)
-                    {
-                        int64 EnumValue = Enum->GetValueByNameString(EnumValueName);
-                        
-                        if (EnumValue != INDEX_NONE)
-                        {
-                            UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Found enum value: %lld"), EnumValue);
-                            EnumProp->GetUnderlyingProperty()->SetIntPropertyValue(
-                                ComponentTemplate, 
-                                EnumValue
-                            );
-                            bSuccess = true;
-                        }
-                        else
-                        {
-                            // List all possible enum values
-                            UE_LOG(LogTemp, Warning, TEXT("SetComponentProperty - Available enum values for %s:"), 
-                                *Enum->GetName());
-                            for (int32 i = 0; i < Enum->NumEnums(); i++)
-                            {
-                                UE_LOG(LogTemp, Warning, TEXT("  - %s (%lld)"), 
-                                    *Enum->GetNameStringByIndex(i),
-                                    Enum->GetValueByIndex(i));
-                            }
-                            
-                            ErrorMessage = FString::Printf(TEXT("Invalid enum value '%s' for property %s"), 
-                                *EnumValueName, *PropertyName);
-                            UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s"), *ErrorMessage);
-                        }
-                    }
-                    else
-                    {
-                        ErrorMessage = TEXT("Enum object is NULL");
-                        UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s"), *ErrorMessage);
-                    }
-                }
-                else if (JsonValue->Type == EJson::Number)
-                {
-                    // Allow setting enum by integer value
-                    int64 EnumValue = JsonValue->AsNumber();
-                    UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Setting enum from number: %lld"), EnumValue);
-                    EnumProp->GetUnderlyingProperty()->SetIntPropertyValue(
-                        ComponentTemplate, 
-                        EnumValue
-                    );
-                    bSuccess = true;
-                }
-                else
-                {
-                    ErrorMessage = TEXT("Enum property requires either a string name or integer value");
-                    UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s"), *ErrorMessage);
-                }
-            }
-            else if (FNumericProperty* NumericProp = CastField<FNumericProperty>(Property))
-            {
-                // Handle numeric properties
-                UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Property is numeric: IsInteger=%d, IsFloat=%d"), 
-                    NumericProp->IsInteger(), NumericProp->IsFloatingPoint());
-                    
-                if (JsonValue->Type == EJson::Number)
-                {
-                    double Value = JsonValue->AsNumber();
-                    UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Setting numeric value: %f"), Value);
-                    
-                    if (NumericProp->IsInteger())
-                    {
-                        NumericProp->SetIntPropertyValue(ComponentTemplate, (int64)Value);
-                        UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Set integer value: %lld"), (int64)Value);
-                        bSuccess = true;
-                    }
-                    else if (NumericProp->IsFloatingPoint())
-                    {
-                        NumericProp->SetFloatingPointPropertyValue(ComponentTemplate, Value);
-                        UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Set float value: %f"), Value);
-                        bSuccess = true;
-                    }
-                }
-                else
-                {
-                    ErrorMessage = TEXT("Numeric property requires a number value");
-                    UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s"), *ErrorMessage);
-                }
-            }
-            else
-            {
-                // Handle all other property types using default handler
-                UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Using generic property handler for %s (Type: %s)"), 
-                    *PropertyName, *Property->GetCPPType());
-                bSuccess = FUnrealMCPCommonUtils::SetObjectProperty(ComponentTemplate, PropertyName, JsonValue, ErrorMessage);
-                if (!bSuccess)
-                {
-                    UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - Failed to set property: %s"), *ErrorMessage);
-                }
-            }
-        }
-        catch (const std::exception& Ex)
-        {
-            UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - EXCEPTION: %s"), ANSI_TO_TCHAR(Ex.what()));
-            return FUnrealMCPCommonUtils::CreateErrorResponse(
-                FString::Printf(TEXT("Exception while setting property %s: %s"), *PropertyName, ANSI_TO_TCHAR(Ex.what())));
-        }
-        catch (...)
-        {
-            UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - UNKNOWN EXCEPTION occurred while setting property %s"), *PropertyName);
+            UE_LOG(LogTemp, Error, TEXT("SetComponentProperty - %s"), *ErrorMessage);
             return FUnrealMCPCommonUtils::CreateErrorResponse(
-                FString::Printf(TEXT("Unknown exception while setting property %s"), *PropertyName));
+                FString::Printf(TEXT("Property %s not found on component %s: %s"), *PropertyName, *ComponentName, *ErrorMessage));
         }
 
-        if (bSuccess)
+        ComponentTemplate->Modify();
+        if (Path->SetValue(ComponentTemplate, JsonValue, ErrorMessage))
         {
+            ComponentTemplate->PostEditChange();
+
             // Mark the blueprint as modified
-            UE_LOG(LogTemp, Log, TEXT("SetComponentProperty - Successfully set property %s on component %s"), 
-                *PropertyName, *ComponentName);
             FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
             FJsonObjectParameter ResultObj = MakeShared<FJsonObject>();
@@ -726,10 +387,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleSetPhysicsProperties(const FJsonO
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Find the component
@@ -796,10 +458,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleCompileBlueprint(const FJsonObjec
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Compile the blueprint
@@ -827,10 +490,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleSpawnBlueprintActor(const FJsonOb
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Get transform parameters
@@ -883,10 +547,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleSetBlueprintProperty(const FJsonO
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Get the default object
@@ -937,10 +602,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleSetStaticMeshProperties(const FJs
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Find the component
@@ -1004,11 +670,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleSetPawnProperties(const FJsonObje
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Get the default object
@@ -1156,10 +822,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleConnectBlueprintNodes(const FJson
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Get the event graph
@@ -1227,10 +894,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleAddBlueprintGetSelfComponentRefer
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Get the event graph
@@ -1297,10 +965,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleAddBlueprintEvent(const FJsonObje
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Get the event graph
@@ -1352,10 +1021,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleAddBlueprintFunctionCall(const FJ
     Params->TryGetStringField(TEXT("target"), Target);
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Get the event graph
@@ -1365,158 +1035,24 @@ FJsonObjectParameter UMCPBlueprintTools::HandleAddBlueprintFunctionCall(const FJ
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get event graph"));
     }
 
-    // Find the function
+    // Find the function: in the target class (or its component class, "StaticMesh" -> StaticMeshComponent), else in the blueprint's own class
+    FMCPSymbolIndex& Symbols = FMCPSymbolIndex::Get();
     UFunction* Function = nullptr;
-    UK2Node_CallFunction* FunctionNode = nullptr;
-    
-    // Add extensive logging for debugging
-    UE_LOG(LogTemp, Display, TEXT("Looking for function '%s' in target '%s'"), 
-           *FunctionName, Target.IsEmpty() ? TEXT("Blueprint") : *Target);
-    
-    // Check if we have a target class specified
     if (!Target.IsEmpty())
     {
-        // Try to find the target class
-        UClass* TargetClass = nullptr;
-        
-        // First try without a prefix
-        TargetClass = FindObject<UClass>(nullptr, *Target);
-        UE_LOG(LogTemp, Display, TEXT("Tried to find class '%s': %s"), 
-               *Target, TargetClass ? TEXT("Found") : TEXT("Not found"));
-        
-        // If not found, try with U prefix (common convention for UE classes)
-        if (!TargetClass && !Target.StartsWith(TEXT("U")))
-        {
-            FString TargetWithPrefix = FString(TEXT("U")) + Target;
-            TargetClass = FindObject<UClass>(_ANY_PACKAGE, *TargetWithPrefix);
-            UE_LOG(LogTemp, Display, TEXT("Tried to find class '%s': %s"), 
-                   *TargetWithPrefix, TargetClass ? TEXT("Found") : TEXT("Not found"));
-        }
-        
-        // If still not found, try with common component names
+        UClass* TargetClass = Symbols.FindClass(Target);
         if (!TargetClass)
         {
-            // Try some common component class names
-            TArray<FString> PossibleClassNames;
-            PossibleClassNames.Add(FString(TEXT("U")) + Target + TEXT("Component"));
-            PossibleClassNames.Add(Target + TEXT("Component"));
-            
-            for (const FString& ClassName : PossibleClassNames)
-            {
-                TargetClass = FindObject<UClass>(_ANY_PACKAGE, *ClassName);
-                if (TargetClass)
-                {
-                    UE_LOG(LogTemp, Display, TEXT("Found class using alternative name '%s'"), *ClassName);
-                    break;
-                }
-            }
-        }
-        
-        // Special case handling for common classes like UGameplayStatics
-        if (!TargetClass && Target == TEXT("UGameplayStatics"))
-        {
-            // For UGameplayStatics, use a direct reference to known class
-            TargetClass = FindObject<UClass>(_ANY_PACKAGE, TEXT("UGameplayStatics"));
-            if (!TargetClass)
-            {
-                // Try loading it from its known package
-                TargetClass = LoadObject<UClass>(nullptr, TEXT("/Script/Engine.GameplayStatics"));
-                UE_LOG(LogTemp, Display, TEXT("Explicitly loading GameplayStatics: %s"), 
-                       TargetClass ? TEXT("Success") : TEXT("Failed"));
-            }
-        }
-        
-        // If we found a target class, look for the function there
-        if (TargetClass)
-        {
-            UE_LOG(LogTemp, Display, TEXT("Looking for function '%s' in class '%s'"), 
-                   *FunctionName, *TargetClass->GetName());
-                   
-            // First try exact name
-            Function = TargetClass->FindFunctionByName(*FunctionName);
-            
-            // If not found, try class hierarchy
-            UClass* CurrentClass = TargetClass;
-            while (!Function && CurrentClass)
-            {
-                UE_LOG(LogTemp, Display, TEXT("Searching in class: %s"), *CurrentClass->GetName());
-                
-                // Try exact match
-                Function = CurrentClass->FindFunctionByName(*FunctionName);
-                
-                // Try case-insensitive match
-                if (!Function)
-                {
-                    for (TFieldIterator<UFunction> FuncIt(CurrentClass); FuncIt; ++FuncIt)
-                    {
-                        UFunction* AvailableFunc = *FuncIt;
-                        UE_LOG(LogTemp, Display, TEXT("  - Available function: %s"), *AvailableFunc->GetName());
-                        
-                        if (AvailableFunc->GetName().Equals(FunctionName, ESearchCase::IgnoreCase))
-                        {
-                            UE_LOG(LogTemp, Display, TEXT("  - Found case-insensitive match: %s"), *AvailableFunc->GetName());
-                            Function = AvailableFunc;
-                            break;
-                        }
-                    }
-                }
-                
-                // Move to parent class
-                CurrentClass = CurrentClass->GetSuperClass();
-            }
-            
-            // Special handling for known functions
-            if (!Function)
-            {
-                if (TargetClass->GetName() == TEXT("GameplayStatics") && 
-                    (FunctionName == TEXT("GetActorOfClass") || FunctionName.Equals(TEXT("GetActorOfClass"), ESearchCase::IgnoreCase)))
-                {
-                    UE_LOG(LogTemp, Display, TEXT("Using special case handling for GameplayStatics::GetActorOfClass"));
-                    
-                    // Create the function node directly
-                    FunctionNode = NewObject<UK2Node_CallFunction>(EventGraph);
-                    if (FunctionNode)
-                    {
-                        // Direct setup for known function
-                        FunctionNode->FunctionReference.SetExternalMember(
-                            FName(TEXT("GetActorOfClass")), 
-                            TargetClass
-                        );
-                        
-                        FunctionNode->NodePosX = NodePosition.X;
-                        FunctionNode->NodePosY = NodePosition.Y;
-                        EventGraph->AddNode(FunctionNode);
-                        FunctionNode->CreateNewGuid();
-                        FunctionNode->PostPlacedNewNode();
-                        FunctionNode->AllocateDefaultPins();
-                        
-                        UE_LOG(LogTemp, Display, TEXT("Created GetActorOfClass node directly"));
-                        
-                        // List all pins
-                        for (UEdGraphPin* Pin : FunctionNode->Pins)
-                        {
-                            UE_LOG(LogTemp, Display, TEXT("  - Pin: %s, Direction: %d, Category: %s"), 
-                                   *Pin->PinName.ToString(), (int32)Pin->Direction, *Pin->PinType.PinCategory.ToString());
-                        }
-                    }
-                }
-            }
+            TargetClass = Symbols.FindClass(Target + TEXT("Component"));
         }
+        Function = Symbols.FindFunction(TargetClass, FunctionName);
     }
-    
-    // If we still haven't found the function, try in the blueprint's class
-    if (!Function && !FunctionNode)
+    if (!Function)
     {
-        UE_LOG(LogTemp, Display, TEXT("Trying to find function in blueprint class"));
-        Function = Blueprint->GeneratedClass->FindFunctionByName(*FunctionName);
+        Function = Symbols.FindFunction(Blueprint->GeneratedClass, FunctionName);
     }
-    
-    // Create the function call node if we found the function
-    if (Function && !FunctionNode)
-    {
-        FunctionNode = FUnrealMCPCommonUtils::CreateFunctionCallNode(EventGraph, Function, NodePosition);
-    }
-    
+
+    UK2Node_CallFunction* FunctionNode = Function ? FUnrealMCPCommonUtils::CreateFunctionCallNode(EventGraph, Function, NodePosition) : nullptr;
     if (!FunctionNode)
     {
         return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Function not found: %s in target %s"), *FunctionName, Target.IsEmpty() ? TEXT("Blueprint") : *Target));
@@ -1538,50 +1074,20 @@ FJsonObjectParameter UMCPBlueprintTools::HandleAddBlueprintFunctionCall(const FJ
                 UEdGraphPin* ParamPin = FUnrealMCPCommonUtils::FindPin(FunctionNode, ParamName, EGPD_Input);
                 if (ParamPin)
                 {
-                    UE_LOG(LogTemp, Display, TEXT("Found parameter pin '%s' of category '%s'"), 
-                           *ParamName, *ParamPin->PinType.PinCategory.ToString());
-                    UE_LOG(LogTemp, Display, TEXT("  Current default value: '%s'"), *ParamPin->DefaultValue);
-                    if (ParamPin->PinType.PinSubCategoryObject.IsValid())
-                    {
-                        UE_LOG(LogTemp, Display, TEXT("  Pin subcategory: '%s'"), 
-                               *ParamPin->PinType.PinSubCategoryObject->GetName());
-                    }
-                    
                     // Set parameter based on type
                     if (ParamValue->Type == EJson::String)
                     {
                         FString StringVal = ParamValue->AsString();
-                        UE_LOG(LogTemp, Display, TEXT("  Setting string parameter '%s' to: '%s'"), 
-                               *ParamName, *StringVal);
-                        
+
                         // Handle class reference parameters (e.g., ActorClass in GetActorOfClass)
                         if (ParamPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Class)
                         {
-                            // For class references, we require the exact class name with proper prefix
-                            // - Actor classes must start with 'A' (e.g., ACameraActor)
-                            // - Non-actor classes must start with 'U' (e.g., UObject)
+                            // Short name with or without prefix (CameraActor / ACameraActor), class path, or Blueprint name
                             const FString& ClassName = StringVal;
-                            
-                            // TODO: This likely won't work in UE5.5+, so don't rely on it.
-                            UClass* Class = FindObject<UClass>(_ANY_PACKAGE, *ClassName);
+                            UClass* Class = FMCPSymbolIndex::Get().FindClass(ClassName);
 
                             if (!Class)
                             {
-                                Class = LoadObject<UClass>(nullptr, *ClassName);
-                                UE_LOG(LogMCPTools, Display, TEXT("FindObject<UClass> failed. Assuming soft path  path: %s"), *ClassName);
-                            }
-                            
-                            // If not found, try with Engine module path
-                            if (!Class)
-                            {
-                                FString EngineClassName = FString::Printf(TEXT("/Script/Engine.%s"), *ClassName);
-                                Class = LoadObject<UClass>(nullptr, *EngineClassName);
-                                UE_LOG(LogMCPTools, Display, TEXT("Trying Engine module path: %s"), *EngineClassName);
-                            }
-                            
-                            if (!Class)
-                            {
-                                UE_LOG(LogMCPTools, Error, TEXT("Failed to find class '%s'. Make sure to use the exact class name with proper prefix (A for actors, U for non-actors)"), *ClassName);
                                 return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to find class '%s'"), *ClassName));
                             }
 
@@ -1599,7 +1105,6 @@ FJsonObjectParameter UMCPBlueprintTools::HandleAddBlueprintFunctionCall(const FJ
                                 return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to set class reference for pin '%s'"), *ParamPin->PinName.ToString()));
                             }
 
-                            UE_LOG(LogMCPTools, Log, TEXT("Successfully set class reference for pin '%s' to '%s'"), *ParamPin->PinName.ToString(), *ClassName);
                             continue;
                         }
                         else if (ParamPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Int)
@@ -1607,23 +1112,17 @@ FJsonObjectParameter UMCPBlueprintTools::HandleAddBlueprintFunctionCall(const FJ
                             // Ensure we're using an integer value (no decimal)
                             int32 IntValue = FMath::RoundToInt(ParamValue->AsNumber());
                             ParamPin->DefaultValue = FString::FromInt(IntValue);
-                            UE_LOG(LogTemp, Display, TEXT("  Set integer parameter '%s' to: %d (string: '%s')"), 
-                                   *ParamName, IntValue, *ParamPin->DefaultValue);
                         }
                         else if (ParamPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Float)
                         {
                             // For other numeric types
                             float FloatValue = ParamValue->AsNumber();
                             ParamPin->DefaultValue = FString::SanitizeFloat(FloatValue);
-                            UE_LOG(LogTemp, Display, TEXT("  Set float parameter '%s' to: %f (string: '%s')"), 
-                                   *ParamName, FloatValue, *ParamPin->DefaultValue);
                         }
                         else if (ParamPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Boolean)
                         {
                             bool BoolValue = ParamValue->AsBool();
                             ParamPin->DefaultValue = BoolValue ? TEXT("true") : TEXT("false");
-                            UE_LOG(LogTemp, Display, TEXT("  Set boolean parameter '%s' to: %s"), 
-                                   *ParamName, *ParamPin->DefaultValue);
                         }
                         else if (ParamPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Struct && ParamPin->PinType.PinSubCategoryObject == TBaseStructure<FVector>::Get())
                         {
@@ -1641,11 +1140,6 @@ FJsonObjectParameter UMCPBlueprintTools::HandleAddBlueprintFunctionCall(const FJ
                                     
                                     FString VectorString = FString::Printf(TEXT("(X=%f,Y=%f,Z=%f)"), X, Y, Z);
                                     ParamPin->DefaultValue = VectorString;
-                                    
-                                    UE_LOG(LogTemp, Display, TEXT("  Set vector parameter '%s' to: %s"), 
-                                           *ParamName, *VectorString);
-                                    UE_LOG(LogTemp, Display, TEXT("  Final pin value: '%s'"), 
-                                           *ParamPin->DefaultValue);
                                 }
                                 else
                                 {
@@ -1662,28 +1156,21 @@ FJsonObjectParameter UMCPBlueprintTools::HandleAddBlueprintFunctionCall(const FJ
                             // Ensure we're using an integer value (no decimal)
                             int32 IntValue = FMath::RoundToInt(ParamValue->AsNumber());
                             ParamPin->DefaultValue = FString::FromInt(IntValue);
-                            UE_LOG(LogTemp, Display, TEXT("  Set integer parameter '%s' to: %d (string: '%s')"), 
-                                   *ParamName, IntValue, *ParamPin->DefaultValue);
                         }
                         else
                         {
                             // For other numeric types
                             float FloatValue = ParamValue->AsNumber();
                             ParamPin->DefaultValue = FString::SanitizeFloat(FloatValue);
-                            UE_LOG(LogTemp, Display, TEXT("  Set float parameter '%s' to: %f (string: '%s')"), 
-                                   *ParamName, FloatValue, *ParamPin->DefaultValue);
                         }
                     }
                     else if (ParamValue->Type == EJson::Boolean)
                     {
                         bool BoolValue = ParamValue->AsBool();
                         ParamPin->DefaultValue = BoolValue ? TEXT("true") : TEXT("false");
-                        UE_LOG(LogTemp, Display, TEXT("  Set boolean parameter '%s' to: %s"), 
-                               *ParamName, *ParamPin->DefaultValue);
                     }
                     else if (ParamValue->Type == EJson::Array)
                     {
-                        UE_LOG(LogTemp, Display, TEXT("  Processing array parameter '%s'"), *ParamName);
                         // Handle array parameters - like Vector parameters
                         const TArray<TSharedPtr<FJsonValue>>* ArrayValue;
                         if (ParamValue->TryGetArray(ArrayValue))
@@ -1700,11 +1187,6 @@ FJsonObjectParameter UMCPBlueprintTools::HandleAddBlueprintFunctionCall(const FJ
                                 
                                 FString VectorString = FString::Printf(TEXT("(X=%f,Y=%f,Z=%f)"), X, Y, Z);
                                 ParamPin->DefaultValue = VectorString;
-                                
-                                UE_LOG(LogTemp, Display, TEXT("  Set vector parameter '%s' to: %s"), 
-                                       *ParamName, *VectorString);
-                                UE_LOG(LogTemp, Display, TEXT("  Final pin value: '%s'"), 
-                                       *ParamPin->DefaultValue);
                             }
                             else
                             {
@@ -1759,10 +1241,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleAddBlueprintVariable(const FJsonO
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Create variable based on type
@@ -1850,10 +1333,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleAddBlueprintInputActionNode(const
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Get the event graph
@@ -1895,10 +1379,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleAddBlueprintSelfReference(const F
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Get the event graph
@@ -1939,10 +1424,11 @@ FJsonObjectParameter UMCPBlueprintTools::HandleFindBlueprintNodes(const FJsonObj
     }
 
     // Find the blueprint
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // Get the event graph
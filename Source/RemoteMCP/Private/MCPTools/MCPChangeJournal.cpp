@@ -0,0 +1,210 @@
+#include "MCPTools/MCPChangeJournal.h"
+
+#include "Editor.h"
+#include "Algo/BinarySearch.h"
+#include "Components/ActorComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace MCPChangeJournal
+{
+	// a few minutes of busy editing; older history is dropped in halves
+	static constexpr int32 MaxChanges = 8192;
+}
+
+FMCPChangeJournal& FMCPChangeJournal::Get()
+{
+	static FMCPChangeJournal Journal;
+	return Journal;
+}
+
+void FMCPChangeJournal::Initialize()
+{
+	if (GEngine)
+	{
+		ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPChangeJournal::OnLevelActorAdded);
+		ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPChangeJournal::OnLevelActorDeleted);
+		ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FMCPChangeJournal::Reset);
+		ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FMCPChangeJournal::OnActorMoved);
+	}
+	LabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FMCPChangeJournal::OnActorLabelChanged);
+	PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FMCPChangeJournal::OnObjectPropertyChanged);
+	MapChangeHandle = FEditorDelegates::MapChange.AddLambda([this](uint32) { Reset(); });
+	// an undone transaction restores objects from the buffer without the per-actor notifications
+	UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FMCPChangeJournal::Reset);
+}
+
+void FMCPChangeJournal::Shutdown()
+{
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+		GEngine->OnActorMoved().Remove(ActorMovedHandle);
+	}
+	FCoreDelegates::OnActorLabelChanged.Remove(LabelChangedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+	FEditorDelegates::MapChange.Remove(MapChangeHandle);
+	FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+	Changes.Empty();
+}
+
+void FMCPChangeJournal::Reset()
+{
+	++Revision;
+	ResetRevision = Revision;
+	Changes.Reset();
+}
+
+void FMCPChangeJournal::Record(EChange Kind, AActor* Actor, FName Property)
+{
+	// only the world the tools work on; PIE and preview worlds are noise here
+	if (!Actor || Actor->GetWorld() != GWorld)
+	{
+		return;
+	}
+
+	if (Changes.Num() >= MCPChangeJournal::MaxChanges)
+	{
+		const int32 Drop = Changes.Num() / 2;
+		ResetRevision = Changes[Drop - 1].Revision;
+		Changes.RemoveAt(0, Drop);
+	}
+
+	FChange& Change = Changes.AddDefaulted_GetRef();
+	Change.Revision = ++Revision;
+	Change.Kind = Kind;
+	Change.Key = FObjectKey(Actor);
+	Change.Actor = Actor;
+	Change.Property = Property;
+	Change.Name = Actor->GetName();
+	Change.Path = Actor->GetPathName();
+}
+
+void FMCPChangeJournal::RecordModified(AActor* Actor, FName Property)
+{
+	Record(EChange::Modified, Actor, Property);
+}
+
+bool FMCPChangeJournal::GetChangesSince(int64 Since, TArray<FActorDelta>& OutDeltas) const
+{
+	if (Since < ResetRevision)
+	{
+		return false;
+	}
+
+	// changes are in revision order; start at the first one after Since
+	const int32 First = Algo::UpperBoundBy(Changes, Since, &FChange::Revision);
+
+	TMap<FObjectKey, int32> DeltaIndex;
+	TArray<bool> Dropped;
+	for (int32 ChangeIndex = First; ChangeIndex < Changes.Num(); ++ChangeIndex)
+	{
+		const FChange& Change = Changes[ChangeIndex];
+		int32* Existing = DeltaIndex.Find(Change.Key);
+		if (!Existing)
+		{
+			DeltaIndex.Add(Change.Key, OutDeltas.Num());
+			FActorDelta& Delta = OutDeltas.AddDefaulted_GetRef();
+			Dropped.Add(false);
+			Delta.Kind = Change.Kind;
+			Delta.Actor = Change.Actor;
+			Delta.Name = Change.Name;
+			Delta.Path = Change.Path;
+			if (!Change.Property.IsNone())
+			{
+				Delta.Properties.Add(Change.Property);
+			}
+			continue;
+		}
+
+		FActorDelta& Delta = OutDeltas[*Existing];
+		switch (Change.Kind)
+		{
+		case EChange::Added:
+			// removed and restored (undo) inside the window: the caller still has it, report it as modified
+			if (Delta.Kind == EChange::Removed)
+			{
+				Delta.Kind = Dropped[*Existing] ? EChange::Added : EChange::Modified;
+				Dropped[*Existing] = false;
+			}
+			break;
+		case EChange::Removed:
+			// added and removed inside the window: the caller never saw it
+			Dropped[*Existing] = Delta.Kind == EChange::Added;
+			Delta.Kind = EChange::Removed;
+			Delta.Name = Change.Name;
+			Delta.Path = Change.Path;
+			break;
+		case EChange::Modified:
+			if (!Change.Property.IsNone())
+			{
+				Delta.Properties.AddUnique(Change.Property);
+			}
+			// follow renames, so a later removal without a notification still reports where the actor was
+			Delta.Name = Change.Name;
+			Delta.Path = Change.Path;
+			break;
+		}
+	}
+
+	for (int32 Index = OutDeltas.Num() - 1; Index >= 0; --Index)
+	{
+		FActorDelta& Delta = OutDeltas[Index];
+		if (Dropped[Index])
+		{
+			OutDeltas.RemoveAt(Index);
+			continue;
+		}
+		// gone without a delete notification (e.g. garbage collected after a level reload)
+		if (Delta.Kind != EChange::Removed && !IsValid(Delta.Actor.Get()))
+		{
+			if (Delta.Kind == EChange::Added)
+			{
+				OutDeltas.RemoveAt(Index);
+				continue;
+			}
+			Delta.Kind = EChange::Removed;
+		}
+	}
+	return true;
+}
+
+void FMCPChangeJournal::OnLevelActorAdded(AActor* Actor)
+{
+	Record(EChange::Added, Actor, NAME_None);
+}
+
+void FMCPChangeJournal::OnLevelActorDeleted(AActor* Actor)
+{
+	Record(EChange::Removed, Actor, NAME_None);
+}
+
+void FMCPChangeJournal::OnActorMoved(AActor* Actor)
+{
+	Record(EChange::Modified, Actor, TEXT("Transform"));
+}
+
+void FMCPChangeJournal::OnActorLabelChanged(AActor* Actor)
+{
+	Record(EChange::Modified, Actor, TEXT("ActorLabel"));
+}
+
+void FMCPChangeJournal::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+	AActor* Actor = Cast<AActor>(Object);
+	if (!Actor)
+	{
+		// component edits count as a change of the owning actor
+		const UActorComponent* Component = Cast<UActorComponent>(Object);
+		Actor = Component ? Component->GetOwner() : nullptr;
+	}
+	if (Actor)
+	{
+		Record(EChange::Modified, Actor, Event.GetPropertyName());
+	}
+}
@@ -1,5 +1,10 @@
 #include "MCPTools/MCPEdGraphTools.h"
 #include "MCPTools/UnrealMCPCommonUtils.h"
+#include "MCPTools/MCPToolRegistry.h"
+#include "MCPTools/MCPGraphIndex.h"
+#include "MCPTools/MCPPagination.h"
+#include "MCPTools/MCPPropertyCodec.h"
+#include "MCPTools/MCPSymbolIndex.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
 #include "EdGraphNode_Comment.h"
@@ -13,12 +18,27 @@
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "Logging/MessageLog.h"
+#include "ScopedTransaction.h"
 #include "Dom/JsonObject.h"
-#include "UObject/UObjectIterator.h"
 #include "UObject/PropertyIterator.h"
 
 // ─────────────────── Private helpers ───────────────────
 
+UObject* UMCPEdGraphTools::LoadObjectForRead(UClass* Class, const FString& Path)
+{
+	if (IsInGameThread())
+	{
+		UObject* Object = StaticLoadObject(Class, nullptr, *Path);
+		if (!Object && Class == UObject::StaticClass())
+		{
+			Object = UEditorAssetLibrary::LoadAsset(Path);
+		}
+		return Object;
+	}
+	// Loading is game-thread only; worker threads can only see objects that are already in memory.
+	return StaticFindObject(Class, nullptr, *Path);
+}
+
 UEdGraphNode* UMCPEdGraphTools::FindNodeInGraph(UEdGraph* Graph, const FString& NodeGuid, const FString& NodeName, const FString& NodePath)
 {
 	if (!Graph)
@@ -26,135 +46,146 @@ UEdGraphNode* UMCPEdGraphTools::FindNodeInGraph(UEdGraph* Graph, const FString&
 		return nullptr;
 	}
 
+	FMCPGraphIndex& Index = FMCPGraphIndex::Get();
 	if (!NodePath.IsEmpty())
 	{
-		UEdGraphNode* Node = LoadObject<UEdGraphNode>(nullptr, *NodePath);
-		if (Node)
+		if (UEdGraphNode* Node = Index.FindNodeByPath(NodePath, Graph))
 		{
 			return Node;
 		}
 	}
-
-	for (UEdGraphNode* Node : Graph->Nodes)
-	{
-		if (!Node)
-		{
-			continue;
-		}
-		if (!NodeGuid.IsEmpty() && Node->NodeGuid.ToString() == NodeGuid)
-		{
-			return Node;
-		}
-		if (!NodeName.IsEmpty() && Node->GetName() == NodeName)
-		{
-			return Node;
-		}
-	}
-	return nullptr;
+	return Index.FindNode(Graph, NodeGuid, NodeName);
 }
 
-TSharedPtr<FJsonObject> UMCPEdGraphTools::SerializePin(UEdGraphPin* Pin)
+void UMCPEdGraphTools::WritePin(FMCPJsonWriter::FWriter& Writer, UEdGraphPin* Pin)
 {
-	TSharedPtr<FJsonObject> PinObj = MakeShared<FJsonObject>();
+	Writer.WriteObjectStart();
 	if (!Pin)
 	{
-		return PinObj;
+		Writer.WriteObjectEnd();
+		return;
 	}
-	PinObj->SetStringField(TEXT("name"), Pin->PinName.ToString());
-	PinObj->SetStringField(TEXT("direction"), (Pin->Direction == EGPD_Input) ? TEXT("Input") : TEXT("Output"));
-	PinObj->SetStringField(TEXT("type"), Pin->PinType.PinCategory.ToString());
+	Writer.WriteValue(TEXT("name"), Pin->PinName.ToString());
+	Writer.WriteValue(TEXT("direction"), FString((Pin->Direction == EGPD_Input) ? TEXT("Input") : TEXT("Output")));
+	Writer.WriteValue(TEXT("type"), Pin->PinType.PinCategory.ToString());
 
 	if (!Pin->PinType.PinSubCategory.IsNone())
 	{
-		PinObj->SetStringField(TEXT("sub_category"), Pin->PinType.PinSubCategory.ToString());
+		Writer.WriteValue(TEXT("sub_category"), Pin->PinType.PinSubCategory.ToString());
 	}
 	if (Pin->PinType.PinSubCategoryObject.IsValid())
 	{
-		PinObj->SetStringField(TEXT("sub_category_object"), Pin->PinType.PinSubCategoryObject->GetPathName());
+		Writer.WriteValue(TEXT("sub_category_object"), Pin->PinType.PinSubCategoryObject->GetPathName());
 	}
 
-	PinObj->SetBoolField(TEXT("is_array"), Pin->PinType.IsArray());
-	PinObj->SetBoolField(TEXT("is_set"), Pin->PinType.IsSet());
-	PinObj->SetBoolField(TEXT("is_map"), Pin->PinType.IsMap());
-	PinObj->SetBoolField(TEXT("is_reference"), Pin->PinType.bIsReference);
-	PinObj->SetBoolField(TEXT("is_const"), Pin->PinType.bIsConst);
+	Writer.WriteValue(TEXT("is_array"), Pin->PinType.IsArray());
+	Writer.WriteValue(TEXT("is_set"), Pin->PinType.IsSet());
+	Writer.WriteValue(TEXT("is_map"), Pin->PinType.IsMap());
+	Writer.WriteValue(TEXT("is_reference"), Pin->PinType.bIsReference);
+	Writer.WriteValue(TEXT("is_const"), Pin->PinType.bIsConst);
 
 	if (!Pin->DefaultValue.IsEmpty())
 	{
-		PinObj->SetStringField(TEXT("default_value"), Pin->DefaultValue);
+		Writer.WriteValue(TEXT("default_value"), Pin->DefaultValue);
 	}
 	if (Pin->DefaultObject)
 	{
-		PinObj->SetStringField(TEXT("default_object"), Pin->DefaultObject->GetPathName());
+		Writer.WriteValue(TEXT("default_object"), Pin->DefaultObject->GetPathName());
 	}
 	if (!Pin->AutogeneratedDefaultValue.IsEmpty())
 	{
-		PinObj->SetStringField(TEXT("auto_generated_default_value"), Pin->AutogeneratedDefaultValue);
+		Writer.WriteValue(TEXT("auto_generated_default_value"), Pin->AutogeneratedDefaultValue);
 	}
 
-	PinObj->SetNumberField(TEXT("linked_to_count"), Pin->LinkedTo.Num());
+	Writer.WriteValue(TEXT("linked_to_count"), Pin->LinkedTo.Num());
 	if (Pin->LinkedTo.Num() > 0)
 	{
-		TArray<TSharedPtr<FJsonValue>> LinkedArray;
+		Writer.WriteArrayStart(TEXT("linked_to"));
 		for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
 		{
 			if (!LinkedPin || !LinkedPin->GetOwningNode())
 			{
 				continue;
 			}
-			TSharedPtr<FJsonObject> LinkObj = MakeShared<FJsonObject>();
-			LinkObj->SetStringField(TEXT("node_guid"), LinkedPin->GetOwningNode()->NodeGuid.ToString());
-			LinkObj->SetStringField(TEXT("node_name"), LinkedPin->GetOwningNode()->GetName());
-			LinkObj->SetStringField(TEXT("pin_name"), LinkedPin->PinName.ToString());
-			LinkedArray.Add(MakeShared<FJsonValueObject>(LinkObj));
+			Writer.WriteObjectStart();
+			Writer.WriteValue(TEXT("node_guid"), LinkedPin->GetOwningNode()->NodeGuid.ToString());
+			Writer.WriteValue(TEXT("node_name"), LinkedPin->GetOwningNode()->GetName());
+			Writer.WriteValue(TEXT("pin_name"), LinkedPin->PinName.ToString());
+			Writer.WriteObjectEnd();
 		}
-		PinObj->SetArrayField(TEXT("linked_to"), LinkedArray);
+		Writer.WriteArrayEnd();
 	}
 
-	return PinObj;
+	Writer.WriteObjectEnd();
 }
 
-TSharedPtr<FJsonObject> UMCPEdGraphTools::SerializeNode(UEdGraphNode* Node, bool bIncludeProperties)
+void UMCPEdGraphTools::WriteNode(FMCPJsonWriter::FWriter& Writer, UEdGraphNode* Node, bool bIncludeProperties, bool bIncludeExportText, const FMCPFieldMask& Fields)
 {
-	TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+	Writer.WriteObjectStart();
 	if (!Node)
 	{
-		return NodeObj;
+		Writer.WriteObjectEnd();
+		return;
 	}
 
-	NodeObj->SetStringField(TEXT("name"), Node->GetName());
-	NodeObj->SetStringField(TEXT("path"), Node->GetPathName());
-	NodeObj->SetStringField(TEXT("class"), Node->GetClass() ? Node->GetClass()->GetName() : TEXT(""));
-	NodeObj->SetStringField(TEXT("guid"), Node->NodeGuid.ToString());
-	NodeObj->SetNumberField(TEXT("pos_x"), Node->NodePosX);
-	NodeObj->SetNumberField(TEXT("pos_y"), Node->NodePosY);
+	if (Fields.Has(TEXT("name")))
+	{
+		Writer.WriteValue(TEXT("name"), Node->GetName());
+	}
+	if (Fields.Has(TEXT("path")))
+	{
+		Writer.WriteValue(TEXT("path"), Node->GetPathName());
+	}
+	if (Fields.Has(TEXT("class")))
+	{
+		Writer.WriteValue(TEXT("class"), Node->GetClass() ? Node->GetClass()->GetName() : TEXT(""));
+	}
+	if (Fields.Has(TEXT("guid")))
+	{
+		Writer.WriteValue(TEXT("guid"), Node->NodeGuid.ToString());
+	}
+	if (Fields.Has(TEXT("pos_x")))
+	{
+		Writer.WriteValue(TEXT("pos_x"), Node->NodePosX);
+	}
+	if (Fields.Has(TEXT("pos_y")))
+	{
+		Writer.WriteValue(TEXT("pos_y"), Node->NodePosY);
+	}
 
-	FString Title = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
-	if (!Title.IsEmpty())
+	// GetNodeTitle is one of the more expensive calls here, skip it when the caller did not ask for it. It runs node
+	// and Blueprint code and fills the node's title cache, so it is game-thread only.
+	if (Fields.Has(TEXT("title")))
 	{
-		NodeObj->SetStringField(TEXT("title"), Title);
+		FString Title = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
+		if (!Title.IsEmpty())
+		{
+			Writer.WriteValue(TEXT("title"), Title);
+		}
 	}
 
-	FString Comment = Node->NodeComment;
-	if (!Comment.IsEmpty())
+	if (Fields.Has(TEXT("comment")) && !Node->NodeComment.IsEmpty())
 	{
-		NodeObj->SetStringField(TEXT("comment"), Comment);
+		Writer.WriteValue(TEXT("comment"), Node->NodeComment);
 	}
 
-	TArray<TSharedPtr<FJsonValue>> PinsArray;
-	for (UEdGraphPin* Pin : Node->Pins)
+	if (Fields.Has(TEXT("pins")))
 	{
-		if (!Pin)
+		Writer.WriteArrayStart(TEXT("pins"));
+		for (UEdGraphPin* Pin : Node->Pins)
 		{
-			continue;
+			if (!Pin)
+			{
+				continue;
+			}
+			WritePin(Writer, Pin);
 		}
-		PinsArray.Add(MakeShared<FJsonValueObject>(SerializePin(Pin)));
+		Writer.WriteArrayEnd();
 	}
-	NodeObj->SetArrayField(TEXT("pins"), PinsArray);
 
-	if (bIncludeProperties)
+	if (bIncludeProperties && Fields.Has(TEXT("properties")))
 	{
-		TSharedPtr<FJsonObject> PropertiesObj = MakeShared<FJsonObject>();
+		Writer.WriteObjectStart(TEXT("properties"));
 		UClass* NodeClass = Node->GetClass();
 		UClass* StopAtClass = UEdGraphNode::StaticClass();
 
@@ -175,61 +206,157 @@ TSharedPtr<FJsonObject> UMCPEdGraphTools::SerializeNode(UEdGraphNode* Node, bool
 				continue;
 			}
 
-			FString ExportedText;
 			const void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(Node);
-			Prop->ExportText_Direct(ExportedText, ValuePtr, nullptr, Node, PPF_None);
-
-			TSharedPtr<FJsonObject> PropObj = MakeShared<FJsonObject>();
-			PropObj->SetStringField(TEXT("type"), Prop->GetCPPType());
-			PropObj->SetStringField(TEXT("export_text"), ExportedText);
-			PropertiesObj->SetObjectField(Prop->GetName(), PropObj);
+			Writer.WriteObjectStart(Prop->GetName());
+			Writer.WriteValue(TEXT("type"), Prop->GetCPPType());
+			// ExportText is the expensive part and duplicates "value"; only callers learning the import_text format need it
+			if (bIncludeExportText)
+			{
+				FString ExportedText;
+				Prop->ExportText_Direct(ExportedText, ValuePtr, nullptr, Node, PPF_None);
+				Writer.WriteValue(TEXT("export_text"), ExportedText);
+			}
+			Writer.WriteIdentifierPrefix(TEXT("value"));
+			FMCPPropertyCodec::Get().Write(Writer, Prop, ValuePtr);
+			Writer.WriteObjectEnd();
 		}
-		NodeObj->SetObjectField(TEXT("properties"), PropertiesObj);
+		Writer.WriteObjectEnd();
 	}
 
-	return NodeObj;
+	Writer.WriteObjectEnd();
 }
 
 UEdGraphPin* UMCPEdGraphTools::FindPinOnNode(UEdGraphNode* Node, const FString& PinName, const FString& Direction)
 {
-	if (!Node || PinName.IsEmpty())
+	EEdGraphPinDirection PinDirection = EGPD_MAX;
+	if (Direction.Equals(TEXT("Input"), ESearchCase::IgnoreCase))
 	{
-		return nullptr;
+		PinDirection = EGPD_Input;
 	}
-	for (UEdGraphPin* Pin : Node->Pins)
+	else if (Direction.Equals(TEXT("Output"), ESearchCase::IgnoreCase))
 	{
-		if (!Pin)
-		{
-			continue;
-		}
-		if (Pin->PinName.ToString() != PinName)
+		PinDirection = EGPD_Output;
+	}
+	return FMCPGraphIndex::Get().FindPin(Node, PinName, PinDirection);
+}
+
+bool UMCPEdGraphTools::SaveAssetIfNeeded(const FString& AssetPath)
+{
+	if (AssetPath.IsEmpty())
+	{
+		return false;
+	}
+	return UEditorAssetLibrary::SaveAsset(AssetPath, false);
+}
+
+UEdGraphNode* UMCPEdGraphTools::CreateNode(UEdGraph* Graph, UClass* NodeClass, int32 PosX, int32 PosY,
+	const TSharedPtr<FJsonObject>& ImportText, const TSharedPtr<FJsonObject>& PinDefaults, FJsonObject& OutImportErrors, FJsonObject& OutPinErrors)
+{
+	UEdGraphNode* Node = NewObject<UEdGraphNode>(Graph, NodeClass);
+	Node->SetFlags(RF_Transactional);
+	Node->CreateNewGuid();
+	Node->NodePosX = PosX;
+	Node->NodePosY = PosY;
+
+	// Apply ImportText properties BEFORE AllocateDefaultPins
+	if (ImportText.IsValid())
+	{
+		for (const auto& Pair : ImportText->Values)
 		{
-			continue;
+			FString TextValue;
+			if (!Pair.Value->TryGetString(TextValue))
+			{
+				OutImportErrors.SetStringField(Pair.Key, TEXT("Value is not a string"));
+				continue;
+			}
+
+			FProperty* Prop = NodeClass->FindPropertyByName(*Pair.Key);
+			if (!Prop)
+			{
+				// Also try in parent classes
+				Prop = FindFProperty<FProperty>(NodeClass, *Pair.Key);
+			}
+			if (!Prop)
+			{
+				OutImportErrors.SetStringField(Pair.Key, TEXT("Property not found"));
+				continue;
+			}
+
+			void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(Node);
+			const TCHAR* Result = Prop->ImportText_Direct(*TextValue, ValuePtr, Node, PPF_None);
+			if (!Result)
+			{
+				OutImportErrors.SetStringField(Pair.Key, FString::Printf(TEXT("ImportText failed for value: %s"), *TextValue));
+			}
 		}
-		if (!Direction.IsEmpty())
+	}
+
+	Node->PostPlacedNewNode();
+	Node->AllocateDefaultPins();
+
+	// Apply pin defaults AFTER AllocateDefaultPins
+	if (PinDefaults.IsValid())
+	{
+		const UEdGraphSchema* Schema = Graph->GetSchema();
+		for (const auto& Pair : PinDefaults->Values)
 		{
-			bool bIsInput = (Pin->Direction == EGPD_Input);
-			if (Direction.Equals(TEXT("Input"), ESearchCase::IgnoreCase) && !bIsInput)
+			FString DefaultValue;
+			if (!Pair.Value->TryGetString(DefaultValue))
 			{
+				OutPinErrors.SetStringField(Pair.Key, TEXT("Value is not a string"));
 				continue;
 			}
-			if (Direction.Equals(TEXT("Output"), ESearchCase::IgnoreCase) && bIsInput)
+
+			UEdGraphPin* Pin = FindPinOnNode(Node, Pair.Key);
+			if (!Pin)
 			{
+				OutPinErrors.SetStringField(Pair.Key, TEXT("Pin not found"));
 				continue;
 			}
+
+			SetPinDefault(Schema, *Pin, DefaultValue);
 		}
-		return Pin;
 	}
-	return nullptr;
+
+	return Node;
 }
 
-bool UMCPEdGraphTools::SaveAssetIfNeeded(const FString& AssetPath)
+UEdGraphNode* UMCPEdGraphTools::CreateCommentNode(UEdGraph* Graph, const FString& Comment, int32 PosX, int32 PosY, int32 Width, int32 Height)
 {
-	if (AssetPath.IsEmpty())
+	UEdGraphNode_Comment* CommentNode = NewObject<UEdGraphNode_Comment>(Graph);
+	CommentNode->SetFlags(RF_Transactional);
+	CommentNode->CreateNewGuid();
+	CommentNode->NodeComment = Comment;
+	CommentNode->NodePosX = PosX;
+	CommentNode->NodePosY = PosY;
+	CommentNode->NodeWidth = Width;
+	CommentNode->NodeHeight = Height;
+	return CommentNode;
+}
+
+void UMCPEdGraphTools::SetPinDefault(const UEdGraphSchema* Schema, UEdGraphPin& Pin, const FString& DefaultValue)
+{
+	if (Schema)
 	{
-		return false;
+		Schema->TrySetDefaultValue(Pin, DefaultValue);
+	}
+	else
+	{
+		Pin.DefaultValue = DefaultValue;
 	}
-	return UEditorAssetLibrary::SaveAsset(AssetPath, false);
+}
+
+bool UMCPEdGraphTools::LinkPins(const UEdGraphSchema* Schema, UEdGraphPin* FromPin, UEdGraphPin* ToPin)
+{
+	// Try Schema first
+	if (Schema && Schema->TryCreateConnection(FromPin, ToPin))
+	{
+		return true;
+	}
+
+	// Fallback: direct link
+	FromPin->MakeLinkTo(ToPin);
+	return FromPin->LinkedTo.Contains(ToPin);
 }
 
 // ─────────────────── HandleFindGraphsInAsset ───────────────────
@@ -249,13 +376,13 @@ FJsonObjectParameter UMCPEdGraphTools::HandleFindGraphsInAsset(const FJsonObject
 	Params->TryGetNumberField(TEXT("max_results"), DMaxResults);
 	int32 MaxResults = FMath::Clamp(static_cast<int32>(DMaxResults), 1, 200);
 
-	UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
-	if (!Asset)
-	{
-		Asset = UEditorAssetLibrary::LoadAsset(AssetPath);
-	}
+	UObject* Asset = LoadObjectForRead(UObject::StaticClass(), AssetPath);
 	if (!Asset)
 	{
+		if (!IsInGameThread())
+		{
+			return FMCPToolRegistry::MakeGameThreadRequiredResponse();
+		}
 		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Asset not found: %s"), *AssetPath));
 	}
 
@@ -361,30 +488,50 @@ FJsonObjectParameter UMCPEdGraphTools::HandleListGraphNodes(const FJsonObjectPar
 
 	bool bIncludeProperties = false;
 	Params->TryGetBoolField(TEXT("include_properties"), bIncludeProperties);
+	bool bIncludeExportText = false;
+	Params->TryGetBoolField(TEXT("include_export_text"), bIncludeExportText);
 
-	UEdGraph* Graph = LoadObject<UEdGraph>(nullptr, *GraphPath);
-	if (!Graph)
+	FMCPPageRequest Page;
+	FString PageError;
+	if (!Page.Parse(Params, TEXT("graph_nodes"), PageError))
 	{
-		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Graph not found: %s"), *GraphPath));
+		return FUnrealMCPCommonUtils::CreateErrorResponse(PageError);
+	}
+	// titles go through node code that caches into the node; only the plain fields are read off the game thread
+	if (!IsInGameThread() && Page.GetFields().Has(TEXT("title")))
+	{
+		return FMCPToolRegistry::MakeGameThreadRequiredResponse();
 	}
 
-	TArray<TSharedPtr<FJsonValue>> NodesArray;
-	for (UEdGraphNode* Node : Graph->Nodes)
+	UEdGraph* Graph = Cast<UEdGraph>(LoadObjectForRead(UEdGraph::StaticClass(), GraphPath));
+	if (!Graph)
 	{
-		if (!Node)
+		if (!IsInGameThread())
 		{
-			continue;
+			return FMCPToolRegistry::MakeGameThreadRequiredResponse();
 		}
-		NodesArray.Add(MakeShared<FJsonValueObject>(SerializeNode(Node, bIncludeProperties)));
+		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Graph not found: %s"), *GraphPath));
 	}
 
-	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-	ResultObj->SetStringField(TEXT("graph_path"), Graph->GetPathName());
-	ResultObj->SetStringField(TEXT("graph_name"), Graph->GetName());
-	ResultObj->SetStringField(TEXT("graph_class"), Graph->GetClass() ? Graph->GetClass()->GetName() : TEXT(""));
-	ResultObj->SetNumberField(TEXT("node_count"), Graph->Nodes.Num());
-	ResultObj->SetArrayField(TEXT("nodes"), NodesArray);
-	return FUnrealMCPCommonUtils::CreateSuccessResponse(ResultObj);
+	// Page in guid order so cursors stay valid while nodes are added or removed
+	TArray<UEdGraphNode*> Nodes = Graph->Nodes;
+	Nodes.RemoveAll([](const UEdGraphNode* Node) { return Node == nullptr; });
+	Page.ApplyKeyed(Nodes, [](const UEdGraphNode* Node) { return Node->NodeGuid.ToString(); });
+
+	FMCPJsonWriter Writer(Nodes.Num() * 1024);
+	Writer.BeginSuccessResponse();
+	Writer->WriteValue(TEXT("graph_path"), Graph->GetPathName());
+	Writer->WriteValue(TEXT("graph_name"), Graph->GetName());
+	Writer->WriteValue(TEXT("graph_class"), Graph->GetClass() ? Graph->GetClass()->GetName() : TEXT(""));
+	Writer->WriteValue(TEXT("node_count"), Graph->Nodes.Num());
+	Writer->WriteArrayStart(TEXT("nodes"));
+	for (UEdGraphNode* Node : Nodes)
+	{
+		WriteNode(Writer.Get(), Node, bIncludeProperties, bIncludeExportText, Page.GetFields());
+	}
+	Writer->WriteArrayEnd();
+	Page.WritePageInfo(Writer.Get());
+	return Writer.Finish();
 }
 
 // ─────────────────── HandleGetGraphNode ───────────────────
@@ -402,9 +549,13 @@ FJsonObjectParameter UMCPEdGraphTools::HandleGetGraphNode(const FJsonObjectParam
 	Params->TryGetStringField(TEXT("node_name"), NodeName);
 	Params->TryGetStringField(TEXT("node_path"), NodePath);
 
-	UEdGraph* Graph = LoadObject<UEdGraph>(nullptr, *GraphPath);
+	UEdGraph* Graph = Cast<UEdGraph>(LoadObjectForRead(UEdGraph::StaticClass(), GraphPath));
 	if (!Graph)
 	{
+		if (!IsInGameThread())
+		{
+			return FMCPToolRegistry::MakeGameThreadRequiredResponse();
+		}
 		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Graph not found: %s"), *GraphPath));
 	}
 
@@ -414,9 +565,14 @@ FJsonObjectParameter UMCPEdGraphTools::HandleGetGraphNode(const FJsonObjectParam
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Node not found"));
 	}
 
-	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-	ResultObj->SetObjectField(TEXT("node"), SerializeNode(Node, true));
-	return FUnrealMCPCommonUtils::CreateSuccessResponse(ResultObj);
+	bool bIncludeExportText = false;
+	Params->TryGetBoolField(TEXT("include_export_text"), bIncludeExportText);
+
+	FMCPJsonWriter Writer;
+	Writer.BeginSuccessResponse();
+	Writer->WriteIdentifierPrefix(TEXT("node"));
+	WriteNode(Writer.Get(), Node, true, bIncludeExportText);
+	return Writer.Finish();
 }
 
 // ─────────────────── HandleDeleteGraphNode ───────────────────
@@ -526,11 +682,13 @@ FJsonObjectParameter UMCPEdGraphTools::HandleSetNodeProperties(const FJsonObject
 		SaveAssetIfNeeded(AutoSavePath);
 	}
 
-	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-	ResultObj->SetObjectField(TEXT("node"), SerializeNode(Node, false));
-	ResultObj->SetObjectField(TEXT("applied"), AppliedObj);
-	ResultObj->SetObjectField(TEXT("errors"), ErrorsObj);
-	return FUnrealMCPCommonUtils::CreateSuccessResponse(ResultObj);
+	FMCPJsonWriter Writer;
+	Writer.BeginSuccessResponse();
+	Writer->WriteIdentifierPrefix(TEXT("node"));
+	WriteNode(Writer.Get(), Node, false);
+	Writer.WriteJsonObject(TEXT("applied"), AppliedObj);
+	Writer.WriteJsonObject(TEXT("errors"), ErrorsObj);
+	return Writer.Finish();
 }
 
 // ─────────────────── HandleListGraphLinks ───────────────────
@@ -543,14 +701,32 @@ FJsonObjectParameter UMCPEdGraphTools::HandleListGraphLinks(const FJsonObjectPar
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'graph_path' parameter"));
 	}
 
-	UEdGraph* Graph = LoadObject<UEdGraph>(nullptr, *GraphPath);
+	UEdGraph* Graph = Cast<UEdGraph>(LoadObjectForRead(UEdGraph::StaticClass(), GraphPath));
 	if (!Graph)
 	{
+		if (!IsInGameThread())
+		{
+			return FMCPToolRegistry::MakeGameThreadRequiredResponse();
+		}
 		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Graph not found: %s"), *GraphPath));
 	}
 
+	FMCPPageRequest Page;
+	FString PageError;
+	if (!Page.Parse(Params, TEXT("graph_links"), PageError))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(PageError);
+	}
+
+	struct FGraphLink
+	{
+		FString Key;
+		UEdGraphPin* A = nullptr;
+		UEdGraphPin* B = nullptr;
+	};
+
 	TSet<FString> Seen;
-	TArray<TSharedPtr<FJsonValue>> LinksArray;
+	TArray<FGraphLink> Links;
 
 	for (UEdGraphNode* Node : Graph->Nodes)
 	{
@@ -577,41 +753,60 @@ FJsonObjectParameter UMCPEdGraphTools::HandleListGraphLinks(const FJsonObjectPar
 				FString OtherGuid = LinkedPin->GetOwningNode()->NodeGuid.ToString();
 				FString OtherPinName = LinkedPin->PinName.ToString();
 
-				// Deduplicate (unordered pair)
+				// Deduplicate (unordered pair); the key doubles as the stable paging order
 				FString KeyA = FString::Printf(TEXT("%s:%s"), *NodeGuid, *PinName);
 				FString KeyB = FString::Printf(TEXT("%s:%s"), *OtherGuid, *OtherPinName);
 				FString Key = (KeyA < KeyB)
 					? FString::Printf(TEXT("%s|%s"), *KeyA, *KeyB)
 					: FString::Printf(TEXT("%s|%s"), *KeyB, *KeyA);
-				if (Seen.Contains(Key))
+				bool bAlreadySeen = false;
+				Seen.Add(Key, &bAlreadySeen);
+				if (bAlreadySeen)
 				{
 					continue;
 				}
-				Seen.Add(Key);
-
-				TSharedPtr<FJsonObject> AObj = MakeShared<FJsonObject>();
-				AObj->SetStringField(TEXT("node_guid"), NodeGuid);
-				AObj->SetStringField(TEXT("node_name"), Node->GetName());
-				AObj->SetStringField(TEXT("pin"), PinName);
-
-				TSharedPtr<FJsonObject> BObj = MakeShared<FJsonObject>();
-				BObj->SetStringField(TEXT("node_guid"), OtherGuid);
-				BObj->SetStringField(TEXT("node_name"), LinkedPin->GetOwningNode()->GetName());
-				BObj->SetStringField(TEXT("pin"), OtherPinName);
-
-				TSharedPtr<FJsonObject> LinkObj = MakeShared<FJsonObject>();
-				LinkObj->SetObjectField(TEXT("a"), AObj);
-				LinkObj->SetObjectField(TEXT("b"), BObj);
-				LinksArray.Add(MakeShared<FJsonValueObject>(LinkObj));
+				Links.Add({ MoveTemp(Key), Pin, LinkedPin });
 			}
 		}
 	}
 
-	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-	ResultObj->SetStringField(TEXT("graph_path"), GraphPath);
-	ResultObj->SetNumberField(TEXT("link_count"), LinksArray.Num());
-	ResultObj->SetArrayField(TEXT("links"), LinksArray);
-	return FUnrealMCPCommonUtils::CreateSuccessResponse(ResultObj);
+	Page.ApplyKeyed(Links, [](const FGraphLink& Link) { return Link.Key; });
+
+	// "fields" selects the endpoint fields (node_guid, node_name, pin) written for both ends
+	const FMCPFieldMask& Fields = Page.GetFields();
+	auto WriteEndpoint = [&Fields](FMCPJsonWriter::FWriter& Writer, const TCHAR* Side, UEdGraphPin* Pin)
+	{
+		Writer.WriteObjectStart(Side);
+		if (Fields.Has(TEXT("node_guid")))
+		{
+			Writer.WriteValue(TEXT("node_guid"), Pin->GetOwningNode()->NodeGuid.ToString());
+		}
+		if (Fields.Has(TEXT("node_name")))
+		{
+			Writer.WriteValue(TEXT("node_name"), Pin->GetOwningNode()->GetName());
+		}
+		if (Fields.Has(TEXT("pin")))
+		{
+			Writer.WriteValue(TEXT("pin"), Pin->PinName.ToString());
+		}
+		Writer.WriteObjectEnd();
+	};
+
+	FMCPJsonWriter Writer;
+	Writer.BeginSuccessResponse();
+	Writer->WriteValue(TEXT("graph_path"), GraphPath);
+	Writer->WriteArrayStart(TEXT("links"));
+	for (const FGraphLink& Link : Links)
+	{
+		Writer->WriteObjectStart();
+		WriteEndpoint(Writer.Get(), TEXT("a"), Link.A);
+		WriteEndpoint(Writer.Get(), TEXT("b"), Link.B);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+	Writer->WriteValue(TEXT("link_count"), Links.Num());
+	Page.WritePageInfo(Writer.Get());
+	return Writer.Finish();
 }
 
 // ─────────────────── HandleConnectPins ───────────────────
@@ -665,21 +860,7 @@ FJsonObjectParameter UMCPEdGraphTools::HandleConnectPins(const FJsonObjectParame
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("From/To pin not found"));
 	}
 
-	bool bOk = false;
-
-	// Try Schema first
-	const UEdGraphSchema* Schema = Graph->GetSchema();
-	if (Schema)
-	{
-		bOk = Schema->TryCreateConnection(FromPin, ToPin);
-	}
-
-	if (!bOk)
-	{
-		// Fallback: direct link
-		FromPin->MakeLinkTo(ToPin);
-		bOk = FromPin->LinkedTo.Contains(ToPin);
-	}
+	const bool bOk = LinkPins(Graph->GetSchema(), FromPin, ToPin);
 
 	if (!AutoSavePath.IsEmpty())
 	{
@@ -781,15 +962,8 @@ FJsonObjectParameter UMCPEdGraphTools::HandleAddCommentNode(const FJsonObjectPar
 
 	Graph->Modify();
 
-	UEdGraphNode_Comment* CommentNode = NewObject<UEdGraphNode_Comment>(Graph);
-	CommentNode->SetFlags(RF_Transactional);
-	CommentNode->CreateNewGuid();
-	CommentNode->NodeComment = Comment;
-	CommentNode->NodePosX = static_cast<int32>(DPosX);
-	CommentNode->NodePosY = static_cast<int32>(DPosY);
-	CommentNode->NodeWidth = static_cast<int32>(DWidth);
-	CommentNode->NodeHeight = static_cast<int32>(DHeight);
-
+	UEdGraphNode* CommentNode = CreateCommentNode(Graph, Comment, static_cast<int32>(DPosX), static_cast<int32>(DPosY),
+		static_cast<int32>(DWidth), static_cast<int32>(DHeight));
 	Graph->AddNode(CommentNode, true, false);
 
 	if (!AutoSavePath.IsEmpty())
@@ -797,44 +971,11 @@ FJsonObjectParameter UMCPEdGraphTools::HandleAddCommentNode(const FJsonObjectPar
 		SaveAssetIfNeeded(AutoSavePath);
 	}
 
-	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-	ResultObj->SetObjectField(TEXT("node"), SerializeNode(CommentNode, false));
-	return FUnrealMCPCommonUtils::CreateSuccessResponse(ResultObj);
-}
-
-// ─────────────────── ResolveNodeClass (private) ───────────────────
-
-UClass* UMCPEdGraphTools::ResolveNodeClass(const FString& ClassName)
-{
-	if (ClassName.IsEmpty()) return nullptr;
-
-	// 1. Full path (e.g. "/Script/BlueprintGraph.K2Node_CallFunction")
-	UClass* Cls = LoadClass<UEdGraphNode>(nullptr, *ClassName);
-	if (Cls) return Cls;
-
-	// 2. Short name exact match
-	Cls = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::NativeFirst);
-	if (Cls && Cls->IsChildOf(UEdGraphNode::StaticClass())) return Cls;
-
-	// 3. Try with "U" prefix
-	if (!ClassName.StartsWith(TEXT("U")))
-	{
-		FString WithU = TEXT("U") + ClassName;
-		Cls = FindFirstObject<UClass>(*WithU, EFindFirstObjectOptions::NativeFirst);
-		if (Cls && Cls->IsChildOf(UEdGraphNode::StaticClass())) return Cls;
-	}
-
-	// 4. Search all classes by name suffix match
-	const FString Target = ClassName;
-	for (TObjectIterator<UClass> It; It; ++It)
-	{
-		if (It->GetName() == Target && It->IsChildOf(UEdGraphNode::StaticClass()))
-		{
-			return *It;
-		}
-	}
-
-	return nullptr;
+	FMCPJsonWriter Writer;
+	Writer.BeginSuccessResponse();
+	Writer->WriteIdentifierPrefix(TEXT("node"));
+	WriteNode(Writer.Get(), CommentNode, false);
+	return Writer.Finish();
 }
 
 // ─────────────────── HandleAddNode ───────────────────
@@ -869,104 +1010,38 @@ FJsonObjectParameter UMCPEdGraphTools::HandleAddNode(const FJsonObjectParameter&
 		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Graph not found: %s"), *GraphPath));
 	}
 
-	UClass* NodeClass = ResolveNodeClass(NodeClassName);
+	FString ClassError;
+	UClass* NodeClass = FMCPSymbolIndex::Get().FindClass(NodeClassName, UEdGraphNode::StaticClass(), ClassError);
 	if (!NodeClass)
 	{
-		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Node class not found: %s"), *NodeClassName));
+		return FUnrealMCPCommonUtils::CreateErrorResponse(ClassError);
 	}
 
 	Graph->Modify();
 
-	UEdGraphNode* Node = NewObject<UEdGraphNode>(Graph, NodeClass);
-	Node->SetFlags(RF_Transactional);
-	Node->CreateNewGuid();
-	Node->NodePosX = static_cast<int32>(DPosX);
-	Node->NodePosY = static_cast<int32>(DPosY);
-
-	// Apply ImportText properties BEFORE AllocateDefaultPins
 	TSharedPtr<FJsonObject> ImportErrors = MakeShared<FJsonObject>();
-	if (ImportTextPtr && ImportTextPtr->IsValid())
-	{
-		for (const auto& Pair : (*ImportTextPtr)->Values)
-		{
-			FString TextValue;
-			if (!Pair.Value->TryGetString(TextValue))
-			{
-				ImportErrors->SetStringField(Pair.Key, TEXT("Value is not a string"));
-				continue;
-			}
-
-			FProperty* Prop = NodeClass->FindPropertyByName(*Pair.Key);
-			if (!Prop)
-			{
-				// Also try in parent classes
-				Prop = FindFProperty<FProperty>(NodeClass, *Pair.Key);
-			}
-			if (!Prop)
-			{
-				ImportErrors->SetStringField(Pair.Key, TEXT("Property not found"));
-				continue;
-			}
-
-			void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(Node);
-			const TCHAR* Result = Prop->ImportText_Direct(*TextValue, ValuePtr, Node, PPF_None);
-			if (!Result)
-			{
-				ImportErrors->SetStringField(Pair.Key, FString::Printf(TEXT("ImportText failed for value: %s"), *TextValue));
-			}
-		}
-	}
-
-	Node->PostPlacedNewNode();
-	Node->AllocateDefaultPins();
-
-	// Apply pin defaults AFTER AllocateDefaultPins
 	TSharedPtr<FJsonObject> PinErrors = MakeShared<FJsonObject>();
-	if (PinDefaultsPtr && PinDefaultsPtr->IsValid())
-	{
-		const UEdGraphSchema* Schema = Graph->GetSchema();
-		for (const auto& Pair : (*PinDefaultsPtr)->Values)
-		{
-			FString DefaultValue;
-			if (!Pair.Value->TryGetString(DefaultValue))
-			{
-				PinErrors->SetStringField(Pair.Key, TEXT("Value is not a string"));
-				continue;
-			}
-
-			UEdGraphPin* Pin = FindPinOnNode(Node, Pair.Key);
-			if (!Pin)
-			{
-				PinErrors->SetStringField(Pair.Key, TEXT("Pin not found"));
-				continue;
-			}
-
-			if (Schema)
-			{
-				Schema->TrySetDefaultValue(*Pin, DefaultValue);
-			}
-			else
-			{
-				Pin->DefaultValue = DefaultValue;
-			}
-		}
-	}
+	UEdGraphNode* Node = CreateNode(Graph, NodeClass, static_cast<int32>(DPosX), static_cast<int32>(DPosY),
+		ImportTextPtr ? *ImportTextPtr : TSharedPtr<FJsonObject>(),
+		PinDefaultsPtr ? *PinDefaultsPtr : TSharedPtr<FJsonObject>(), *ImportErrors, *PinErrors);
 
 	Graph->AddNode(Node, true, false);
 
-	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-	ResultObj->SetObjectField(TEXT("node"), SerializeNode(Node, true));
+	FMCPJsonWriter Writer;
+	Writer.BeginSuccessResponse();
+	Writer->WriteIdentifierPrefix(TEXT("node"));
+	WriteNode(Writer.Get(), Node, true);
 
 	if (ImportErrors->Values.Num() > 0)
 	{
-		ResultObj->SetObjectField(TEXT("import_errors"), ImportErrors);
+		Writer.WriteJsonObject(TEXT("import_errors"), ImportErrors);
 	}
 	if (PinErrors->Values.Num() > 0)
 	{
-		ResultObj->SetObjectField(TEXT("pin_errors"), PinErrors);
+		Writer.WriteJsonObject(TEXT("pin_errors"), PinErrors);
 	}
 
-	return FUnrealMCPCommonUtils::CreateSuccessResponse(ResultObj);
+	return Writer.Finish();
 }
 
 // ─────────────────── HandleSetPinDefaultValue ───────────────────
@@ -1018,15 +1093,7 @@ FJsonObjectParameter UMCPEdGraphTools::HandleSetPinDefaultValue(const FJsonObjec
 		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Pin '%s' not found"), *PinName));
 	}
 
-	const UEdGraphSchema* Schema = Graph->GetSchema();
-	if (Schema)
-	{
-		Schema->TrySetDefaultValue(*Pin, DefaultValue);
-	}
-	else
-	{
-		Pin->DefaultValue = DefaultValue;
-	}
+	SetPinDefault(Graph->GetSchema(), *Pin, DefaultValue);
 
 	if (!DefaultObjectPath.IsEmpty())
 	{
@@ -1037,8 +1104,440 @@ FJsonObjectParameter UMCPEdGraphTools::HandleSetPinDefaultValue(const FJsonObjec
 		}
 	}
 
+	FMCPJsonWriter Writer;
+	Writer.BeginSuccessResponse();
+	Writer->WriteIdentifierPrefix(TEXT("pin"));
+	WritePin(Writer.Get(), Pin);
+	return Writer.Finish();
+}
+
+// ─────────────────── HandleApplyGraphPatch ───────────────────
+
+namespace MCPGraphPatch
+{
+	struct FNodeSpec
+	{
+		FString Id;
+		UClass* Class = nullptr;
+		TSharedPtr<FJsonObject> Object;
+	};
+
+	struct FLinkSpec
+	{
+		FString FromNode;
+		FString FromPin;
+		FString ToNode;
+		FString ToPin;
+	};
+
+	struct FDefaultSpec
+	{
+		FString Node;
+		FString Pin;
+		FString Value;
+		FString Object;
+		FString Direction;
+	};
+
+	struct FPropertySpec
+	{
+		FString Node;
+		TSharedPtr<FJsonObject> Values;
+	};
+
+	/** The objects of an optional array field; false (with OutError set) when an element is not an object. */
+	static bool GetObjects(const FJsonObjectParameter& Params, const TCHAR* Field, TArray<TSharedPtr<FJsonObject>>& OutObjects, FString& OutError)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		if (!Params->TryGetArrayField(Field, Values))
+		{
+			return true;
+		}
+		OutObjects.Reserve(Values->Num());
+		for (int32 Index = 0; Index < Values->Num(); ++Index)
+		{
+			const TSharedPtr<FJsonObject>* Object = nullptr;
+			if (!(*Values)[Index]->TryGetObject(Object) || !Object->IsValid())
+			{
+				OutError = FString::Printf(TEXT("%s[%d] must be an object"), Field, Index);
+				return false;
+			}
+			OutObjects.Add(*Object);
+		}
+		return true;
+	}
+
+	static int32 GetInt(const TSharedPtr<FJsonObject>& Object, const TCHAR* Field, double Default)
+	{
+		double Value = Default;
+		Object->TryGetNumberField(Field, Value);
+		return static_cast<int32>(Value);
+	}
+}
+
+FJsonObjectParameter UMCPEdGraphTools::HandleApplyGraphPatch(const FJsonObjectParameter& Params)
+{
+	using namespace MCPGraphPatch;
+
+	FString GraphPath;
+	if (!Params->TryGetStringField(TEXT("graph_path"), GraphPath))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'graph_path' parameter"));
+	}
+
+	FString Error;
+	TArray<TSharedPtr<FJsonObject>> NodeObjects, CommentObjects, LinkObjects, DefaultObjects, PropertyObjects;
+	if (!GetObjects(Params, TEXT("nodes"), NodeObjects, Error)
+		|| !GetObjects(Params, TEXT("comments"), CommentObjects, Error)
+		|| !GetObjects(Params, TEXT("links"), LinkObjects, Error)
+		|| !GetObjects(Params, TEXT("defaults"), DefaultObjects, Error)
+		|| !GetObjects(Params, TEXT("properties"), PropertyObjects, Error))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+	}
+
+	TArray<FString> DeleteRefs;
+	Params->TryGetStringArrayField(TEXT("delete"), DeleteRefs);
+
+	FString AutoSavePath;
+	Params->TryGetStringField(TEXT("auto_save_asset_path"), AutoSavePath);
+	bool bTransaction = true;
+	Params->TryGetBoolField(TEXT("transaction"), bTransaction);
+	FString TransactionName = TEXT("MCP Apply Graph Patch");
+	Params->TryGetStringField(TEXT("transaction_name"), TransactionName);
+
+	UEdGraph* Graph = LoadObject<UEdGraph>(nullptr, *GraphPath);
+	if (!Graph)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Graph not found: %s"), *GraphPath));
+	}
+
+	// Everything that can be checked before the graph changes is checked here, so a malformed patch leaves it untouched.
+	TSet<FString> LocalIds;
+	auto AddLocalId = [&LocalIds, &Error](const FString& Id, const FString& Where)
+	{
+		bool bDuplicate = false;
+		LocalIds.Add(Id, &bDuplicate);
+		if (bDuplicate)
+		{
+			Error = FString::Printf(TEXT("%s: duplicate id '%s'"), *Where, *Id);
+		}
+		return !bDuplicate;
+	};
+
+	TArray<FNodeSpec> NodeSpecs;
+	NodeSpecs.Reserve(NodeObjects.Num());
+	for (int32 Index = 0; Index < NodeObjects.Num(); ++Index)
+	{
+		const FString Where = FString::Printf(TEXT("nodes[%d]"), Index);
+		FNodeSpec& Spec = NodeSpecs.AddDefaulted_GetRef();
+		Spec.Object = NodeObjects[Index];
+
+		FString ClassName;
+		if (!Spec.Object->TryGetStringField(TEXT("id"), Spec.Id) || Spec.Id.IsEmpty())
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("%s: missing 'id'"), *Where));
+		}
+		if (!Spec.Object->TryGetStringField(TEXT("node_class"), ClassName))
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("%s: missing 'node_class'"), *Where));
+		}
+		if (!AddLocalId(Spec.Id, Where))
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+		}
+
+		FString ClassError;
+		Spec.Class = FMCPSymbolIndex::Get().FindClass(ClassName, UEdGraphNode::StaticClass(), ClassError);
+		if (!Spec.Class)
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("%s: %s"), *Where, *ClassError));
+		}
+	}
+
+	for (int32 Index = 0; Index < CommentObjects.Num(); ++Index)
+	{
+		const FString Where = FString::Printf(TEXT("comments[%d]"), Index);
+		FString Id;
+		if (!CommentObjects[Index]->HasTypedField<EJson::String>(TEXT("comment")))
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("%s: missing 'comment'"), *Where));
+		}
+		if (CommentObjects[Index]->TryGetStringField(TEXT("id"), Id) && !Id.IsEmpty() && !AddLocalId(Id, Where))
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+		}
+	}
+
+	TArray<UEdGraphNode*> ToDelete;
+	for (const FString& Ref : DeleteRefs)
+	{
+		UEdGraphNode* Node = FindNodeInGraph(Graph, Ref, Ref, TEXT(""));
+		if (!Node)
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("delete: node not found: %s"), *Ref));
+		}
+		ToDelete.AddUnique(Node);
+	}
+
+	// A node reference is a local id of this patch, else the guid or object name of a node already in the graph.
+	TMap<FString, UEdGraphNode*> ExistingNodes;
+	auto CheckRef = [&](const TSharedPtr<FJsonObject>& Object, const TCHAR* Field, const FString& Where, FString& OutRef)
+	{
+		if (!Object->TryGetStringField(Field, OutRef) || OutRef.IsEmpty())
+		{
+			Error = FString::Printf(TEXT("%s: missing '%s'"), *Where, Field);
+			return false;
+		}
+		if (LocalIds.Contains(OutRef) || ExistingNodes.Contains(OutRef))
+		{
+			return true;
+		}
+		UEdGraphNode* Node = FindNodeInGraph(Graph, OutRef, OutRef, TEXT(""));
+		if (!Node || ToDelete.Contains(Node))
+		{
+			Error = FString::Printf(TEXT("%s: node not found: %s"), *Where, *OutRef);
+			return false;
+		}
+		ExistingNodes.Add(OutRef, Node);
+		return true;
+	};
+	auto CheckString = [&Error](const TSharedPtr<FJsonObject>& Object, const TCHAR* Field, const FString& Where, FString& OutValue)
+	{
+		if (!Object->TryGetStringField(Field, OutValue))
+		{
+			Error = FString::Printf(TEXT("%s: missing '%s'"), *Where, Field);
+			return false;
+		}
+		return true;
+	};
+
+	TArray<FLinkSpec> LinkSpecs;
+	LinkSpecs.Reserve(LinkObjects.Num());
+	for (int32 Index = 0; Index < LinkObjects.Num(); ++Index)
+	{
+		const FString Where = FString::Printf(TEXT("links[%d]"), Index);
+		FLinkSpec& Spec = LinkSpecs.AddDefaulted_GetRef();
+		if (!CheckRef(LinkObjects[Index], TEXT("from_node"), Where, Spec.FromNode)
+			|| !CheckString(LinkObjects[Index], TEXT("from_pin"), Where, Spec.FromPin)
+			|| !CheckRef(LinkObjects[Index], TEXT("to_node"), Where, Spec.ToNode)
+			|| !CheckString(LinkObjects[Index], TEXT("to_pin"), Where, Spec.ToPin))
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+		}
+	}
+
+	TArray<FDefaultSpec> DefaultSpecs;
+	DefaultSpecs.Reserve(DefaultObjects.Num());
+	for (int32 Index = 0; Index < DefaultObjects.Num(); ++Index)
+	{
+		const FString Where = FString::Printf(TEXT("defaults[%d]"), Index);
+		FDefaultSpec& Spec = DefaultSpecs.AddDefaulted_GetRef();
+		if (!CheckRef(DefaultObjects[Index], TEXT("node"), Where, Spec.Node)
+			|| !CheckString(DefaultObjects[Index], TEXT("pin"), Where, Spec.Pin))
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+		}
+		DefaultObjects[Index]->TryGetStringField(TEXT("value"), Spec.Value);
+		DefaultObjects[Index]->TryGetStringField(TEXT("object"), Spec.Object);
+		DefaultObjects[Index]->TryGetStringField(TEXT("direction"), Spec.Direction);
+	}
+
+	TArray<FPropertySpec> PropertySpecs;
+	PropertySpecs.Reserve(PropertyObjects.Num());
+	for (int32 Index = 0; Index < PropertyObjects.Num(); ++Index)
+	{
+		const FString Where = FString::Printf(TEXT("properties[%d]"), Index);
+		FPropertySpec& Spec = PropertySpecs.AddDefaulted_GetRef();
+		const TSharedPtr<FJsonObject>* Values = nullptr;
+		if (!CheckRef(PropertyObjects[Index], TEXT("node"), Where, Spec.Node))
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+		}
+		if (!PropertyObjects[Index]->TryGetObjectField(TEXT("values"), Values) || !Values->IsValid())
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("%s: missing 'values'"), *Where));
+		}
+		Spec.Values = *Values;
+	}
+
+	// Apply. New nodes go straight into Nodes without per-node notifications; the graph is told once at the end.
+	// Per-item failures (pins that do not exist on a new node, rejected connections, bad values) are reported
+	// in 'errors' and do not stop the rest of the patch, as with handle_add_node's pin_errors.
+	TArray<TSharedPtr<FJsonValue>> Errors;
+	auto AddError = [&Errors](const FString& Message)
+	{
+		Errors.Add(MakeShared<FJsonValueString>(Message));
+	};
+
+	TMap<FString, UEdGraphNode*> CreatedNodes;
+	TSharedPtr<FJsonObject> IdsObj = MakeShared<FJsonObject>();
+	int32 LinkCount = 0;
+	int32 DefaultCount = 0;
+	{
+		FScopedTransaction Transaction(FText::FromString(TransactionName), bTransaction);
+		Graph->Modify();
+		const UEdGraphSchema* Schema = Graph->GetSchema();
+
+		// DestroyNode runs the node's own clean-up (timeline templates, bound graphs, ...); taking the node out of
+		// Nodes beforehand leaves the base implementation's RemoveNode nothing to remove but its notification
+		for (UEdGraphNode* Node : ToDelete)
+		{
+			Node->Modify();
+			Node->BreakAllNodeLinks();
+			Graph->Nodes.Remove(Node);
+			Node->DestroyNode();
+		}
+		if (!ToDelete.IsEmpty())
+		{
+			// removed nodes keep their outer, so the index cannot tell them apart from live ones until it rebuilds
+			FMCPGraphIndex::Get().Invalidate(Graph);
+		}
+
+		Graph->Nodes.Reserve(Graph->Nodes.Num() + NodeSpecs.Num() + CommentObjects.Num());
+		for (const FNodeSpec& Spec : NodeSpecs)
+		{
+			const TSharedPtr<FJsonObject>* ImportTextPtr = nullptr;
+			Spec.Object->TryGetObjectField(TEXT("import_text"), ImportTextPtr);
+			const TSharedPtr<FJsonObject>* PinDefaultsPtr = nullptr;
+			Spec.Object->TryGetObjectField(TEXT("pin_defaults"), PinDefaultsPtr);
+
+			FJsonObject ImportErrors, PinErrors;
+			UEdGraphNode* Node = CreateNode(Graph, Spec.Class, GetInt(Spec.Object, TEXT("pos_x"), 0), GetInt(Spec.Object, TEXT("pos_y"), 0),
+				ImportTextPtr ? *ImportTextPtr : TSharedPtr<FJsonObject>(),
+				PinDefaultsPtr ? *PinDefaultsPtr : TSharedPtr<FJsonObject>(), ImportErrors, PinErrors);
+			Graph->Nodes.Add(Node);
+
+			for (const auto& Pair : ImportErrors.Values)
+			{
+				AddError(FString::Printf(TEXT("%s: import_text %s: %s"), *Spec.Id, *Pair.Key, *Pair.Value->AsString()));
+			}
+			for (const auto& Pair : PinErrors.Values)
+			{
+				AddError(FString::Printf(TEXT("%s: pin_defaults %s: %s"), *Spec.Id, *Pair.Key, *Pair.Value->AsString()));
+			}
+
+			CreatedNodes.Add(Spec.Id, Node);
+			IdsObj->SetStringField(Spec.Id, Node->NodeGuid.ToString());
+		}
+
+		for (const TSharedPtr<FJsonObject>& Object : CommentObjects)
+		{
+			UEdGraphNode* Node = CreateCommentNode(Graph, Object->GetStringField(TEXT("comment")),
+				GetInt(Object, TEXT("pos_x"), 0), GetInt(Object, TEXT("pos_y"), 0),
+				GetInt(Object, TEXT("width"), 400), GetInt(Object, TEXT("height"), 100));
+			Graph->Nodes.Add(Node);
+
+			FString Id;
+			if (Object->TryGetStringField(TEXT("id"), Id) && !Id.IsEmpty())
+			{
+				CreatedNodes.Add(Id, Node);
+				IdsObj->SetStringField(Id, Node->NodeGuid.ToString());
+			}
+		}
+
+		auto ResolveRef = [&CreatedNodes, &ExistingNodes](const FString& Ref)
+		{
+			UEdGraphNode* const* Created = CreatedNodes.Find(Ref);
+			return Created ? *Created : ExistingNodes.FindRef(Ref);
+		};
+
+		// properties first: a K2 node rebuilds its pins from them (ReconstructNode), and the links and defaults below
+		// need the rebuilt pins
+		for (int32 Index = 0; Index < PropertySpecs.Num(); ++Index)
+		{
+			const FPropertySpec& Spec = PropertySpecs[Index];
+			UEdGraphNode* Node = ResolveRef(Spec.Node);
+			Node->Modify();
+			bool bChanged = false;
+			for (const auto& Pair : Spec.Values->Values)
+			{
+				FString ErrorMessage;
+				if (FUnrealMCPCommonUtils::SetObjectProperty(Node, Pair.Key, Pair.Value, ErrorMessage))
+				{
+					bChanged = true;
+				}
+				else
+				{
+					AddError(FString::Printf(TEXT("properties[%d]: %s: %s"), Index, *Pair.Key, *ErrorMessage));
+				}
+			}
+			if (bChanged)
+			{
+				Node->ReconstructNode();
+			}
+		}
+
+		for (int32 Index = 0; Index < LinkSpecs.Num(); ++Index)
+		{
+			const FLinkSpec& Spec = LinkSpecs[Index];
+			UEdGraphPin* FromPin = FindPinOnNode(ResolveRef(Spec.FromNode), Spec.FromPin);
+			UEdGraphPin* ToPin = FindPinOnNode(ResolveRef(Spec.ToNode), Spec.ToPin);
+			if (!FromPin || !ToPin)
+			{
+				AddError(FString::Printf(TEXT("links[%d]: pin '%s' not found on '%s'"), Index,
+					FromPin ? *Spec.ToPin : *Spec.FromPin, FromPin ? *Spec.ToNode : *Spec.FromNode));
+				continue;
+			}
+			if (LinkPins(Schema, FromPin, ToPin))
+			{
+				++LinkCount;
+			}
+			else
+			{
+				AddError(FString::Printf(TEXT("links[%d]: failed to connect %s.%s -> %s.%s"), Index,
+					*Spec.FromNode, *Spec.FromPin, *Spec.ToNode, *Spec.ToPin));
+			}
+		}
+
+		for (int32 Index = 0; Index < DefaultSpecs.Num(); ++Index)
+		{
+			const FDefaultSpec& Spec = DefaultSpecs[Index];
+			UEdGraphNode* Node = ResolveRef(Spec.Node);
+			UEdGraphPin* Pin = FindPinOnNode(Node, Spec.Pin, Spec.Direction);
+			if (!Pin)
+			{
+				AddError(FString::Printf(TEXT("defaults[%d]: pin '%s' not found on '%s'"), Index, *Spec.Pin, *Spec.Node));
+				continue;
+			}
+
+			Node->Modify();
+			SetPinDefault(Schema, *Pin, Spec.Value);
+			if (!Spec.Object.IsEmpty())
+			{
+				UObject* DefaultObj = LoadObject<UObject>(nullptr, *Spec.Object);
+				if (!DefaultObj)
+				{
+					AddError(FString::Printf(TEXT("defaults[%d]: object not found: %s"), Index, *Spec.Object));
+					continue;
+				}
+				Pin->DefaultObject = DefaultObj;
+			}
+			++DefaultCount;
+		}
+
+		Graph->NotifyGraphChanged();
+		if (UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph))
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+		}
+	}
+
+	if (!AutoSavePath.IsEmpty())
+	{
+		SaveAssetIfNeeded(AutoSavePath);
+	}
+
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-	ResultObj->SetObjectField(TEXT("pin"), SerializePin(Pin));
+	ResultObj->SetObjectField(TEXT("ids"), IdsObj);
+	ResultObj->SetNumberField(TEXT("created"), NodeSpecs.Num() + CommentObjects.Num());
+	ResultObj->SetNumberField(TEXT("deleted"), ToDelete.Num());
+	ResultObj->SetNumberField(TEXT("linked"), LinkCount);
+	ResultObj->SetNumberField(TEXT("defaults_set"), DefaultCount);
+	if (!Errors.IsEmpty())
+	{
+		ResultObj->SetArrayField(TEXT("errors"), Errors);
+	}
 	return FUnrealMCPCommonUtils::CreateSuccessResponse(ResultObj);
 }
 
@@ -1277,10 +1776,13 @@ FJsonObjectParameter UMCPEdGraphTools::HandleGetAssetInfo(const FJsonObjectParam
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'asset_path' parameter"));
 	}
 
-	UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
-	if (!Asset) Asset = UEditorAssetLibrary::LoadAsset(AssetPath);
+	UObject* Asset = LoadObjectForRead(UObject::StaticClass(), AssetPath);
 	if (!Asset)
 	{
+		if (!IsInGameThread())
+		{
+			return FMCPToolRegistry::MakeGameThreadRequiredResponse();
+		}
 		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Asset not found: %s"), *AssetPath));
 	}
 
@@ -4,9 +4,19 @@
 #include "MCPTools/MCPEditorTools.h"
 #include "MCPTools/MCPEditorTools.h"
 #include "MCPTools/UnrealMCPCommonUtils.h"
+#include "MCPTools/MCPActorFilter.h"
+#include "MCPTools/MCPActorIndex.h"
+#include "MCPTools/MCPChangeJournal.h"
+#include "MCPTools/MCPPropertyCodec.h"
+#include "MCPTools/MCPPropertyDump.h"
+#include "MCPTools/MCPPropertyPath.h"
+#include "MCPTools/MCPSnapshotStore.h"
+#include "MCPTools/MCPSpatialIndex.h"
+#include "MCPTools/MCPSymbolIndex.h"
 #include "Editor.h"
 #include "EditorViewportClient.h"
 #include "LevelEditorViewport.h"
+#include "SceneView.h"
 #include "ImageUtils.h"
 #include "HighResScreenshot.h"
 #include "Engine/GameViewportClient.h"
@@ -20,6 +30,8 @@
 #include "Engine/SpotLight.h"
 #include "Camera/CameraActor.h"
 #include "Components/StaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
 #include "EditorSubsystem.h"
 #include "Subsystems/EditorActorSubsystem.h"
 #include "Engine/Blueprint.h"
@@ -31,33 +43,49 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "EditorAssetLibrary.h"
 #include "JsonObjectConverter.h"
+#include "ScopedTransaction.h"
 
 
 /**
- * 获取当前关卡中的所有Actor
- * 此函数不需要任何输入参数，将返回场景中所有Actor的信息
+ * 获取当前关卡中的Actor
+ * 可选过滤条件 class/tags/folder/level/data_layer/name_contains/where(见FMCPActorFilter)，一次遍历求值
+ * 可选分页参数 limit/cursor/fields，按Actor路径排序
  */
 FJsonObjectParameter UMCPEditorTools::HandleGetActorsInLevel(const FJsonObjectParameter& Params)
 {
-    // 获取所有Actor
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
+    FMCPPageRequest Page;
+    FString PageError;
+    if (!Page.Parse(Params, TEXT("actors"), PageError))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(PageError);
+    }
 
-    // 将Actor信息转换为JSON数组
-    TArray<TSharedPtr<FJsonValue>> ActorArray;
-    for (AActor* Actor : AllActors)
+    FMCPActorFilter Filter;
+    FString FilterError;
+    if (!Filter.Parse(*Params, FilterError))
     {
-        if (Actor)
-        {
-            ActorArray.Add(FUnrealMCPCommonUtils::ActorToJson(Actor));
-        }
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FilterError);
     }
 
-    // 构建结果JSON对象
-    FJsonObjectParameter ResultObj = MakeShared<FJsonObject>();
-    ResultObj->SetArrayField(TEXT("actors"), ActorArray);
+    // 从Actor索引取候选并过滤，不再遍历整个世界
+    TArray<AActor*> AllActors;
+    Filter.Gather(AllActors);
+    Page.ApplyKeyed(AllActors, [](const AActor* Actor) { return Actor->GetPathName(); });
+
+    // 直接流式写出JSON，避免为每个Actor构建JsonObject
+    FMCPJsonWriter Writer(AllActors.Num() * 160);
+    Writer.BeginObject();
+    // 关卡修订号，之后可用 HandleGetActorChangesSince 只取增量
+    Writer->WriteValue(TEXT("revision"), FMCPChangeJournal::Get().GetRevision());
+    Writer->WriteArrayStart(TEXT("actors"));
+    for (AActor* Actor : AllActors)
+    {
+        FUnrealMCPCommonUtils::WriteActorJson(Writer.Get(), Actor, Page.GetFields());
+    }
+    Writer->WriteArrayEnd();
+    Page.WritePageInfo(Writer.Get());
 
-    return ResultObj;
+    return Writer.Finish();
 }
 
 /**
@@ -73,25 +101,198 @@ FJsonObjectParameter UMCPEditorTools::HandleFindActorsByName(const FJsonObjectPa
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'pattern' parameter"));
     }
 
+    FMCPPageRequest Page;
+    FString PageError;
+    if (!Page.Parse(Params, TEXT("actors_by_name"), PageError))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(PageError);
+    }
+
     // 获取所有Actor
     TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
+    FMCPActorIndex::Get().GetAllActors(AllActors);
 
     // 查找名称包含模式的Actor
-    TArray<TSharedPtr<FJsonValue>> MatchingActors;
+    AllActors.RemoveAll([&Pattern](const AActor* Actor) { return !Actor->GetName().Contains(Pattern); });
+    Page.ApplyKeyed(AllActors, [](const AActor* Actor) { return Actor->GetPathName(); });
+
+    FMCPJsonWriter Writer;
+    Writer.BeginObject();
+    Writer->WriteArrayStart(TEXT("actors"));
     for (AActor* Actor : AllActors)
     {
-        if (Actor && Actor->GetName().Contains(Pattern))
+        FUnrealMCPCommonUtils::WriteActorJson(Writer.Get(), Actor, Page.GetFields());
+    }
+    Writer->WriteArrayEnd();
+    Page.WritePageInfo(Writer.Get());
+
+    return Writer.Finish();
+}
+
+namespace MCPSpatialQuery
+{
+    /** 解析查询中心："actor"(以该Actor位置为中心)或"center"[x,y,z] */
+    static bool ResolveCenter(const FJsonObjectParameter& Params, FVector& OutCenter, AActor*& OutOriginActor, FString& OutError)
+    {
+        OutOriginActor = nullptr;
+        FString ActorName;
+        if (Params->TryGetStringField(TEXT("actor"), ActorName))
         {
-            MatchingActors.Add(FUnrealMCPCommonUtils::ActorToJson(Actor));
+            OutOriginActor = FMCPActorIndex::Get().FindActor(ActorName);
+            if (!OutOriginActor)
+            {
+                OutError = FString::Printf(TEXT("Actor not found: %s"), *ActorName);
+                return false;
+            }
+            OutCenter = OutOriginActor->GetActorLocation();
+            return true;
         }
+        if (Params->HasField(TEXT("center")))
+        {
+            OutCenter = FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("center"));
+            return true;
+        }
+        OutError = TEXT("Missing 'center' or 'actor' parameter");
+        return false;
     }
 
-    // 构建结果JSON对象
-    FJsonObjectParameter ResultObj = MakeShared<FJsonObject>();
-    ResultObj->SetArrayField(TEXT("actors"), MatchingActors);
+    /** 按距离顺序分页写出命中的Actor，每项附带"distance" */
+    static FJsonObjectParameter WriteHits(const FJsonObjectParameter& Params, const TCHAR* Scope, TArray<FMCPSpatialIndex::FHit>& Hits)
+    {
+        FMCPPageRequest Page;
+        FString PageError;
+        if (!Page.Parse(Params, Scope, PageError))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(PageError);
+        }
+        Page.ApplyOrdered(Hits);
 
-    return ResultObj;
+        const FMCPFieldMask& Fields = Page.GetFields();
+        FMCPJsonWriter Writer(Hits.Num() * 180);
+        Writer.BeginObject();
+        Writer->WriteArrayStart(TEXT("actors"));
+        for (const FMCPSpatialIndex::FHit& Hit : Hits)
+        {
+            Writer->WriteObjectStart();
+            FUnrealMCPCommonUtils::WriteActorFields(Writer.Get(), Hit.Actor, Fields);
+            if (Fields.Has(TEXT("distance")))
+            {
+                Writer->WriteValue(TEXT("distance"), Hit.Distance);
+            }
+            Writer->WriteObjectEnd();
+        }
+        Writer->WriteArrayEnd();
+        Page.WritePageInfo(Writer.Get());
+        return Writer.Finish();
+    }
+}
+
+/**
+ * 查找与球体相交的Actor，按距离由近到远排列
+ */
+FJsonObjectParameter UMCPEditorTools::HandleFindActorsInRadius(const FJsonObjectParameter& Params)
+{
+    FVector Center;
+    AActor* OriginActor = nullptr;
+    FString Error;
+    if (!MCPSpatialQuery::ResolveCenter(Params, Center, OriginActor, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    double Radius = 0.0;
+    if (!Params->TryGetNumberField(TEXT("radius"), Radius) || Radius < 0.0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing or negative 'radius' parameter"));
+    }
+
+    TArray<FMCPSpatialIndex::FHit> Hits;
+    FMCPSpatialIndex::Get().QueryRadius(Center, Radius, Hits);
+    Hits.RemoveAll([OriginActor](const FMCPSpatialIndex::FHit& Hit) { return Hit.Actor == OriginActor; });
+    return MCPSpatialQuery::WriteHits(Params, TEXT("actors_in_radius"), Hits);
+}
+
+/**
+ * 查找与轴对齐包围盒相交(或完全位于其内)的Actor
+ */
+FJsonObjectParameter UMCPEditorTools::HandleFindActorsInBox(const FJsonObjectParameter& Params)
+{
+    if (!Params->HasField(TEXT("min")) || !Params->HasField(TEXT("max")))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'min' or 'max' parameter"));
+    }
+    const FVector Min = FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("min"));
+    const FVector Max = FUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("max"));
+    const FBox Box(FVector::Min(Min, Max), FVector::Max(Min, Max));
+
+    bool bFullyInside = false;
+    Params->TryGetBoolField(TEXT("fully_inside"), bFullyInside);
+
+    TArray<FMCPSpatialIndex::FHit> Hits;
+    FMCPSpatialIndex::Get().QueryBox(Box, bFullyInside, Hits);
+    return MCPSpatialQuery::WriteHits(Params, TEXT("actors_in_box"), Hits);
+}
+
+/**
+ * 查找当前活动视口视锥内可见范围的Actor，按到相机的距离排列
+ */
+FJsonObjectParameter UMCPEditorTools::HandleFindActorsInViewFrustum(const FJsonObjectParameter& Params)
+{
+    FViewport* Viewport = GEditor ? GEditor->GetActiveViewport() : nullptr;
+    FEditorViewportClient* ViewportClient = Viewport ? static_cast<FEditorViewportClient*>(Viewport->GetClient()) : nullptr;
+    if (!ViewportClient)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get active viewport"));
+    }
+
+    double MaxDistance = 0.0;
+    Params->TryGetNumberField(TEXT("max_distance"), MaxDistance);
+
+    // 视图由ViewFamily持有，随其一起释放
+    FSceneViewFamilyContext ViewFamily(FSceneViewFamily::ConstructionValues(Viewport, ViewportClient->GetScene(), ViewportClient->EngineShowFlags));
+    const FSceneView* View = ViewportClient->CalcSceneView(&ViewFamily);
+    if (!View)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to compute the viewport view"));
+    }
+
+    TArray<FMCPSpatialIndex::FHit> Hits;
+    FMCPSpatialIndex::Get().QueryFrustum(View->ViewFrustum, View->ViewMatrices.GetViewOrigin(), MaxDistance, Hits);
+    return MCPSpatialQuery::WriteHits(Params, TEXT("actors_in_frustum"), Hits);
+}
+
+/**
+ * 查找距离指定点(或Actor)最近的K个Actor
+ */
+FJsonObjectParameter UMCPEditorTools::HandleFindNearestActors(const FJsonObjectParameter& Params)
+{
+    FVector Center;
+    AActor* OriginActor = nullptr;
+    FString Error;
+    if (!MCPSpatialQuery::ResolveCenter(Params, Center, OriginActor, Error))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    int32 Count = 10;
+    Params->TryGetNumberField(TEXT("count"), Count);
+    if (Count <= 0)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'count' must be positive"));
+    }
+
+    double MaxDistance = 0.0;
+    Params->TryGetNumberField(TEXT("max_distance"), MaxDistance);
+
+    // 以Actor为中心时多取一个，再排除其自身
+    TArray<FMCPSpatialIndex::FHit> Hits;
+    FMCPSpatialIndex::Get().QueryNearest(Center, OriginActor ? Count + 1 : Count, MaxDistance, Hits);
+    Hits.RemoveAll([OriginActor](const FMCPSpatialIndex::FHit& Hit) { return Hit.Actor == OriginActor; });
+    if (Hits.Num() > Count)
+    {
+        Hits.SetNum(Count);
+    }
+    return MCPSpatialQuery::WriteHits(Params, TEXT("nearest_actors"), Hits);
 }
 
 /**
@@ -140,14 +341,9 @@ FJsonObjectParameter UMCPEditorTools::HandleSpawnActor(const FJsonObjectParamete
     }
 
     // 检查是否已存在同名Actor
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
-    for (AActor* Actor : AllActors)
+    if (FMCPActorIndex::Get().FindByName(FName(*ActorName)))
     {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
-        }
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
     }
 
     // 设置生成参数
@@ -209,26 +405,19 @@ FJsonObjectParameter UMCPEditorTools::HandleDeleteActor(const FJsonObjectParamet
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
     }
 
-    // 获取所有Actor
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-
     // 查找并删除指定Actor
-    for (AActor* Actor : AllActors)
+    if (AActor* Actor = FMCPActorIndex::Get().FindActor(ActorName))
     {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            // 在删除前保存Actor信息用于响应
-            FJsonObjectParameter ActorInfo = FUnrealMCPCommonUtils::ActorToJsonObject(Actor);
+        // 在删除前保存Actor信息用于响应
+        FJsonObjectParameter ActorInfo = FUnrealMCPCommonUtils::ActorToJsonObject(Actor);
 
-            // 删除Actor
-            Actor->Destroy();
+        // 删除Actor(变更日志由OnLevelActorDeleted记录)
+        Actor->Destroy();
 
-            // 构建结果JSON对象
-            FJsonObjectParameter ResultObj = MakeShared<FJsonObject>();
-            ResultObj->SetObjectField(TEXT("deleted_actor"), ActorInfo);
-            return ResultObj;
-        }
+        // 构建结果JSON对象
+        FJsonObjectParameter ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetObjectField(TEXT("deleted_actor"), ActorInfo);
+        return ResultObj;
     }
 
     return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
@@ -248,18 +437,7 @@ FJsonObjectParameter UMCPEditorTools::HandleSetActorTransform(const FJsonObjectP
     }
 
     // 查找目标Actor
-    AActor* TargetActor = nullptr;
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-
-    for (AActor* Actor : AllActors)
-    {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            TargetActor = Actor;
-            break;
-        }
-    }
+    AActor* TargetActor = FMCPActorIndex::Get().FindActor(ActorName);
 
     if (!TargetActor)
     {
@@ -284,14 +462,16 @@ FJsonObjectParameter UMCPEditorTools::HandleSetActorTransform(const FJsonObjectP
 
     // 设置新的变换
     TargetActor->SetActorTransform(NewTransform);
+    FMCPSpatialIndex::Get().NotifyActorMoved(TargetActor);
+    FMCPChangeJournal::Get().RecordModified(TargetActor, TEXT("Transform"));
 
     // 返回更新后的Actor信息
     return FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
 }
 
 /**
- * 获取Actor的所有属性
- * 返回Actor的详细属性信息
+ * 获取Actor的属性
+ * 与原型的比较和输出在同一遍遍历中完成，默认值不会被序列化
  */
 FJsonObjectParameter UMCPEditorTools::HandleGetActorProperties(const FJsonObjectParameter& Params)
 {
@@ -303,26 +483,53 @@ FJsonObjectParameter UMCPEditorTools::HandleGetActorProperties(const FJsonObject
     }
 
     // 查找目标Actor
-    AActor* TargetActor = nullptr;
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
+    AActor* TargetActor = FMCPActorIndex::Get().FindActor(ActorName);
 
-    for (AActor* Actor : AllActors)
+    if (!TargetActor)
     {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            TargetActor = Actor;
-            break;
-        }
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
     }
 
-    if (!TargetActor)
+    FMCPPropertyDump::FOptions Options;
+    Options.Parse(*Params);
+    bool bIncludeComponents = true;
+    Params->TryGetBoolField(TEXT("include_components"), bIncludeComponents);
+
+    FMCPJsonWriter Writer;
+    Writer.BeginObject();
+    FUnrealMCPCommonUtils::WriteActorFields(Writer.Get(), TargetActor, FMCPFieldMask());
+    Writer->WriteValue(TEXT("non_default_only"), Options.bNonDefaultOnly);
+
+    FMCPPropertyDump Dump(Writer, Options);
+    Writer->WriteObjectStart(TEXT("properties"));
+    Dump.WriteObject(TargetActor);
+    Writer->WriteObjectEnd();
+
+    if (bIncludeComponents)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+        // 组件属性路径以组件名开头，例如"StaticMeshComponent.StaticMesh"
+        TInlineComponentArray<UActorComponent*> Components(TargetActor);
+        Writer->WriteArrayStart(TEXT("components"));
+        for (UActorComponent* Component : Components)
+        {
+            const FString ComponentName = Component->GetName();
+            if (!Dump.IsWanted(ComponentName))
+            {
+                continue;
+            }
+            Writer->WriteObjectStart();
+            Writer->WriteValue(TEXT("name"), ComponentName);
+            Writer->WriteValue(TEXT("class"), Component->GetClass()->GetName());
+            Writer->WriteObjectStart(TEXT("properties"));
+            Dump.WriteObject(Component, ComponentName);
+            Writer->WriteObjectEnd();
+            Writer->WriteObjectEnd();
+        }
+        Writer->WriteArrayEnd();
     }
 
-    // 返回Actor的详细属性
-    return FUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
+    Dump.WriteSummary();
+    return Writer.Finish();
 }
 
 /**
@@ -339,18 +546,7 @@ FJsonObjectParameter UMCPEditorTools::HandleSetActorProperty(const FJsonObjectPa
     }
 
     // 查找目标Actor
-    AActor* TargetActor = nullptr;
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-
-    for (AActor* Actor : AllActors)
-    {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            TargetActor = Actor;
-            break;
-        }
-    }
+    AActor* TargetActor = FMCPActorIndex::Get().FindActor(ActorName);
 
     if (!TargetActor)
     {
@@ -376,7 +572,10 @@ FJsonObjectParameter UMCPEditorTools::HandleSetActorProperty(const FJsonObjectPa
     FString ErrorMessage;
     if (FUnrealMCPCommonUtils::SetObjectProperty(TargetActor, PropertyName, PropertyValue, ErrorMessage))
     {
-        // 属性设置成功
+        // 属性设置成功；属性可能影响包围盒(网格、缩放等)，刷新空间索引
+        FMCPSpatialIndex::Get().NotifyActorMoved(TargetActor);
+        FMCPChangeJournal::Get().RecordModified(TargetActor, FName(*PropertyName));
+
         FJsonObjectParameter ResultObj = MakeShared<FJsonObject>();
         ResultObj->SetStringField(TEXT("actor"), ActorName);
         ResultObj->SetStringField(TEXT("property"), PropertyName);
@@ -392,6 +591,298 @@ FJsonObjectParameter UMCPEditorTools::HandleSetActorProperty(const FJsonObjectPa
     }
 }
 
+/**
+ * 获取指定修订号之后的Actor变化(新增/删除/修改)，代替重复列出整个关卡
+ */
+FJsonObjectParameter UMCPEditorTools::HandleGetActorChangesSince(const FJsonObjectParameter& Params)
+{
+    double SinceValue = 0.0;
+    if (!Params->TryGetNumberField(TEXT("revision"), SinceValue))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'revision' parameter"));
+    }
+    const int64 Since = static_cast<int64>(SinceValue);
+
+    FMCPFieldMask Fields;
+    Fields.Parse(*Params);
+
+    FMCPChangeJournal& Journal = FMCPChangeJournal::Get();
+    TArray<FMCPChangeJournal::FActorDelta> Deltas;
+    const bool bHasHistory = Journal.GetChangesSince(Since, Deltas);
+
+    FMCPJsonWriter Writer(Deltas.Num() * 160);
+    Writer.BeginObject();
+    Writer->WriteValue(TEXT("revision"), Journal.GetRevision());
+    Writer->WriteValue(TEXT("since"), Since);
+    // 历史已被截断或发生了无法描述的批量变化(撤销、关卡切换等)，需要重新列出关卡
+    Writer->WriteValue(TEXT("reset"), !bHasHistory);
+
+    auto WriteDeltas = [&Writer, &Deltas, &Fields](const TCHAR* Identifier, FMCPChangeJournal::EChange Kind)
+    {
+        Writer->WriteArrayStart(Identifier);
+        for (const FMCPChangeJournal::FActorDelta& Delta : Deltas)
+        {
+            if (Delta.Kind != Kind)
+            {
+                continue;
+            }
+            Writer->WriteObjectStart();
+            if (Kind == FMCPChangeJournal::EChange::Removed)
+            {
+                Writer->WriteValue(TEXT("name"), Delta.Name);
+                Writer->WriteValue(TEXT("path"), Delta.Path);
+            }
+            else
+            {
+                FUnrealMCPCommonUtils::WriteActorFields(Writer.Get(), Delta.Actor.Get(), Fields);
+            }
+            if (Kind == FMCPChangeJournal::EChange::Modified && Delta.Properties.Num() > 0)
+            {
+                Writer->WriteArrayStart(TEXT("properties"));
+                for (const FName& Property : Delta.Properties)
+                {
+                    Writer->WriteValue(Property.ToString());
+                }
+                Writer->WriteArrayEnd();
+            }
+            Writer->WriteObjectEnd();
+        }
+        Writer->WriteArrayEnd();
+    };
+    WriteDeltas(TEXT("added"), FMCPChangeJournal::EChange::Added);
+    WriteDeltas(TEXT("modified"), FMCPChangeJournal::EChange::Modified);
+    WriteDeltas(TEXT("removed"), FMCPChangeJournal::EChange::Removed);
+
+    return Writer.Finish();
+}
+
+namespace MCPBulkEdit
+{
+    /** 读取"items"数组，并读取可选的事务参数 */
+    static const TArray<TSharedPtr<FJsonValue>>* GetItems(const FJsonObjectParameter& Params, bool& bOutTransaction, FString& OutTransactionName, const TCHAR* DefaultName)
+    {
+        bOutTransaction = true;
+        Params->TryGetBoolField(TEXT("transaction"), bOutTransaction);
+        OutTransactionName = DefaultName;
+        Params->TryGetStringField(TEXT("transaction_name"), OutTransactionName);
+
+        const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
+        return Params->TryGetArrayField(TEXT("items"), Items) ? Items : nullptr;
+    }
+
+    /** 单项结果: {"index","actor","success","error"?} */
+    static void WriteItemResult(FMCPJsonWriter::FWriter& Writer, int32 Index, const FString& ActorName, const FString& Error)
+    {
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("index"), Index);
+        Writer.WriteValue(TEXT("actor"), ActorName);
+        Writer.WriteValue(TEXT("success"), Error.IsEmpty());
+        if (!Error.IsEmpty())
+        {
+            Writer.WriteValue(TEXT("error"), Error);
+        }
+        Writer.WriteObjectEnd();
+    }
+}
+
+/**
+ * 批量设置多个Actor的变换
+ * 所有修改在同一个事务中完成，PostEditMove(构造脚本等)推迟到全部写入之后每个Actor只执行一次
+ */
+FJsonObjectParameter UMCPEditorTools::HandleBulkSetActorTransforms(const FJsonObjectParameter& Params)
+{
+    bool bTransaction = true;
+    FString TransactionName;
+    const TArray<TSharedPtr<FJsonValue>>* Items = MCPBulkEdit::GetItems(Params, bTransaction, TransactionName, TEXT("MCP Bulk Set Transforms"));
+    if (!Items)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'items' parameter"));
+    }
+
+    FScopedTransaction Transaction(FText::FromString(TransactionName), bTransaction);
+
+    FMCPJsonWriter Writer(Items->Num() * 64);
+    Writer.BeginObject();
+    Writer->WriteArrayStart(TEXT("results"));
+
+    TArray<AActor*> MovedActors;
+    MovedActors.Reserve(Items->Num());
+    int32 Failed = 0;
+    for (int32 Index = 0; Index < Items->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* Item = nullptr;
+        FString ActorName;
+        if (!(*Items)[Index]->TryGetObject(Item) || !(*Item)->TryGetStringField(TEXT("actor"), ActorName))
+        {
+            MCPBulkEdit::WriteItemResult(Writer.Get(), Index, ActorName, TEXT("Item must be an object with an 'actor' field"));
+            ++Failed;
+            continue;
+        }
+
+        AActor* Actor = FMCPActorIndex::Get().FindActor(ActorName);
+        if (!Actor)
+        {
+            MCPBulkEdit::WriteItemResult(Writer.Get(), Index, ActorName, FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+            ++Failed;
+            continue;
+        }
+
+        // "relative": true 时各分量为增量(位置/旋转相加，缩放相乘)
+        bool bRelative = false;
+        (*Item)->TryGetBoolField(TEXT("relative"), bRelative);
+
+        FTransform NewTransform = Actor->GetActorTransform();
+        if ((*Item)->HasField(TEXT("location")))
+        {
+            const FVector Location = FUnrealMCPCommonUtils::GetVectorFromJson(*Item, TEXT("location"));
+            NewTransform.SetLocation(bRelative ? NewTransform.GetLocation() + Location : Location);
+        }
+        if ((*Item)->HasField(TEXT("rotation")))
+        {
+            const FQuat Rotation(FUnrealMCPCommonUtils::GetRotatorFromJson(*Item, TEXT("rotation")));
+            NewTransform.SetRotation(bRelative ? Rotation * NewTransform.GetRotation() : Rotation);
+        }
+        if ((*Item)->HasField(TEXT("scale")))
+        {
+            const FVector Scale = FUnrealMCPCommonUtils::GetVectorFromJson(*Item, TEXT("scale"));
+            NewTransform.SetScale3D(bRelative ? NewTransform.GetScale3D() * Scale : Scale);
+        }
+
+        Actor->Modify();
+        Actor->SetActorTransform(NewTransform, false, nullptr, ETeleportType::TeleportPhysics);
+        MovedActors.AddUnique(Actor);
+        MCPBulkEdit::WriteItemResult(Writer.Get(), Index, ActorName, FString());
+    }
+    Writer->WriteArrayEnd();
+
+    // 推迟的编辑器通知：每个Actor一次(PostEditMove广播OnActorMoved，空间索引和变更日志由此更新)
+    for (AActor* Actor : MovedActors)
+    {
+        Actor->PostEditMove(true);
+    }
+
+    Writer->WriteValue(TEXT("updated"), MovedActors.Num());
+    Writer->WriteValue(TEXT("failed"), Failed);
+    return Writer.Finish();
+}
+
+/**
+ * 批量设置多个Actor的属性
+ * items: [{"actor", "property", "value"}] 或 [{"actor", "properties": {名称: 值}}]
+ * 所有修改在同一个事务中完成，PostEditChange推迟到全部写入之后每个Actor只执行一次
+ */
+FJsonObjectParameter UMCPEditorTools::HandleBulkSetActorProperties(const FJsonObjectParameter& Params)
+{
+    bool bTransaction = true;
+    FString TransactionName;
+    const TArray<TSharedPtr<FJsonValue>>* Items = MCPBulkEdit::GetItems(Params, bTransaction, TransactionName, TEXT("MCP Bulk Set Properties"));
+    if (!Items)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'items' parameter"));
+    }
+
+    FScopedTransaction Transaction(FText::FromString(TransactionName), bTransaction);
+
+    FMCPJsonWriter Writer(Items->Num() * 64);
+    Writer.BeginObject();
+    Writer->WriteArrayStart(TEXT("results"));
+
+    // 每个Actor记录被修改的属性，最后统一发送PostEditChange
+    TArray<TPair<AActor*, TArray<FProperty*>>> Touched;
+    int32 Failed = 0;
+    for (int32 Index = 0; Index < Items->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* Item = nullptr;
+        FString ActorName;
+        if (!(*Items)[Index]->TryGetObject(Item) || !(*Item)->TryGetStringField(TEXT("actor"), ActorName))
+        {
+            MCPBulkEdit::WriteItemResult(Writer.Get(), Index, ActorName, TEXT("Item must be an object with an 'actor' field"));
+            ++Failed;
+            continue;
+        }
+
+        TArray<TPair<FString, TSharedPtr<FJsonValue>>> Assignments;
+        const TSharedPtr<FJsonObject>* Properties = nullptr;
+        FString PropertyName;
+        if ((*Item)->TryGetObjectField(TEXT("properties"), Properties))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Properties)->Values)
+            {
+                Assignments.Emplace(Pair.Key, Pair.Value);
+            }
+        }
+        else if ((*Item)->TryGetStringField(TEXT("property"), PropertyName) && (*Item)->HasField(TEXT("value")))
+        {
+            Assignments.Emplace(PropertyName, (*Item)->TryGetField(TEXT("value")));
+        }
+        else
+        {
+            MCPBulkEdit::WriteItemResult(Writer.Get(), Index, ActorName, TEXT("Item needs 'property' and 'value', or 'properties'"));
+            ++Failed;
+            continue;
+        }
+
+        AActor* Actor = FMCPActorIndex::Get().FindActor(ActorName);
+        if (!Actor)
+        {
+            MCPBulkEdit::WriteItemResult(Writer.Get(), Index, ActorName, FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+            ++Failed;
+            continue;
+        }
+
+        TPair<AActor*, TArray<FProperty*>>* Entry = Touched.FindByPredicate([Actor](const TPair<AActor*, TArray<FProperty*>>& Pair) { return Pair.Key == Actor; });
+        if (!Entry)
+        {
+            Actor->Modify();
+            Entry = &Touched.Emplace_GetRef(Actor, TArray<FProperty*>());
+        }
+
+        FString Error;
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Assignment : Assignments)
+        {
+            FString PropertyError;
+            // 编译后的属性路径已缓存，直接取它的顶层属性用于PostEditChangeProperty
+            const FMCPPropertyPath* Path = FMCPPropertyPathCache::Get().Find(Actor->GetClass(), Assignment.Key, PropertyError);
+            if (Path && Path->SetValue(Actor, Assignment.Value, PropertyError))
+            {
+                Entry->Value.AddUnique(Path->GetRootProperty());
+            }
+            else
+            {
+                Error += Error.IsEmpty() ? PropertyError : TEXT("; ") + PropertyError;
+            }
+        }
+        Failed += Error.IsEmpty() ? 0 : 1;
+        MCPBulkEdit::WriteItemResult(Writer.Get(), Index, ActorName, Error);
+    }
+    Writer->WriteArrayEnd();
+
+    // 推迟的编辑器通知：单个属性时带上属性信息，多个属性时发送一次通用的PostEditChange
+    int32 Updated = 0;
+    for (TPair<AActor*, TArray<FProperty*>>& Pair : Touched)
+    {
+        if (Pair.Value.IsEmpty())
+        {
+            continue;
+        }
+        if (Pair.Value.Num() == 1)
+        {
+            FPropertyChangedEvent Event(Pair.Value[0], EPropertyChangeType::ValueSet);
+            Pair.Key->PostEditChangeProperty(Event);
+        }
+        else
+        {
+            Pair.Key->PostEditChange();
+        }
+        FMCPSpatialIndex::Get().NotifyActorMoved(Pair.Key);
+        ++Updated;
+    }
+
+    Writer->WriteValue(TEXT("updated"), Updated);
+    Writer->WriteValue(TEXT("failed"), Failed);
+    return Writer.Finish();
+}
+
 /**
  * 在关卡中生成蓝图Actor
  * 根据指定的蓝图路径和名称创建Actor实例
@@ -411,12 +902,12 @@ FJsonObjectParameter UMCPEditorTools::HandleSpawnBlueprintActor(const FJsonObjec
         return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actor_name' parameter"));
     }
 
-    // 查找蓝图资源
-    FString AssetPath = TEXT("/Game/Blueprints/") + BlueprintName;
-    UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *AssetPath);
+    // 查找蓝图资源（资源名或路径）
+    FString BlueprintError;
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
     if (!Blueprint)
     {
-        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
     }
 
     // 获取变换参数
@@ -464,6 +955,397 @@ FJsonObjectParameter UMCPEditorTools::HandleSpawnBlueprintActor(const FJsonObjec
     return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to spawn blueprint actor"));
 }
 
+namespace MCPBulkSpawn
+{
+    static FTransform ReadTransform(const TSharedPtr<FJsonObject>& Item)
+    {
+        FTransform Transform;
+        if (Item->HasField(TEXT("location")))
+        {
+            Transform.SetLocation(FUnrealMCPCommonUtils::GetVectorFromJson(Item, TEXT("location")));
+        }
+        if (Item->HasField(TEXT("rotation")))
+        {
+            Transform.SetRotation(FQuat(FUnrealMCPCommonUtils::GetRotatorFromJson(Item, TEXT("rotation"))));
+        }
+        if (Item->HasField(TEXT("scale")))
+        {
+            Transform.SetScale3D(FUnrealMCPCommonUtils::GetVectorFromJson(Item, TEXT("scale")));
+        }
+        return Transform;
+    }
+
+    static void ApplyProperties(AActor* Actor, const TSharedPtr<FJsonObject>* Properties, FString& InOutError)
+    {
+        if (!Properties)
+        {
+            return;
+        }
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Properties)->Values)
+        {
+            FString PropertyError;
+            if (!FUnrealMCPCommonUtils::SetObjectProperty(Actor, Pair.Key, Pair.Value, PropertyError))
+            {
+                InOutError += InOutError.IsEmpty() ? PropertyError : TEXT("; ") + PropertyError;
+            }
+        }
+    }
+
+    /** "instanced"模式：所有实例写入一个ISM组件，只生成一个承载Actor */
+    static FJsonObjectParameter SpawnInstanced(UWorld* World, const FJsonObjectParameter& Params, const TArray<TSharedPtr<FJsonValue>>& Instances)
+    {
+        FString MeshPath;
+        if (!Params->TryGetStringField(TEXT("mesh"), MeshPath))
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Instanced mode needs a 'mesh' parameter"));
+        }
+        UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+        if (!Mesh)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Static mesh not found: %s"), *MeshPath));
+        }
+
+        // 实例没有各自的对象，属性无处可写；直接拒绝而不是静默忽略
+        bool bHasProperties = Params->HasField(TEXT("properties"));
+        for (const TSharedPtr<FJsonValue>& Value : Instances)
+        {
+            const TSharedPtr<FJsonObject>* Item = nullptr;
+            bHasProperties |= Value.IsValid() && Value->TryGetObject(Item) && (*Item)->HasField(TEXT("properties"));
+        }
+        if (bHasProperties)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Instanced mode does not support 'properties'"));
+        }
+
+        TArray<FTransform> Transforms;
+        Transforms.Reserve(Instances.Num());
+        for (const TSharedPtr<FJsonValue>& Value : Instances)
+        {
+            const TSharedPtr<FJsonObject>* Item = nullptr;
+            if (Value.IsValid() && Value->TryGetObject(Item))
+            {
+                Transforms.Add(ReadTransform(*Item));
+            }
+        }
+
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.ObjectFlags |= RF_Transactional;
+        FString ActorName;
+        if (Params->TryGetStringField(TEXT("name"), ActorName) && !ActorName.IsEmpty())
+        {
+            if (FMCPActorIndex::Get().FindByName(FName(*ActorName)))
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
+            }
+            SpawnParams.Name = *ActorName;
+        }
+
+        // 只记录撤销，不标脏；生成成功后才标脏关卡
+        ULevel* Level = World->GetCurrentLevel();
+        Level->Modify(false);
+        AActor* Container = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+        if (!Container)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to spawn the instance container actor"));
+        }
+
+        UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(Container, TEXT("Instances"), RF_Transactional);
+        Component->SetMobility(EComponentMobility::Static);
+        Container->SetRootComponent(Component);
+        Container->AddInstanceComponent(Component);
+        Component->SetStaticMesh(Mesh);
+        Component->RegisterComponent();
+        Component->AddInstances(Transforms, false, true);
+
+        FString Folder;
+        if (Params->TryGetStringField(TEXT("folder"), Folder))
+        {
+            Container->SetFolderPath(FName(*Folder));
+        }
+        Level->MarkPackageDirty();
+        GEditor->RedrawLevelEditingViewports();
+
+        FMCPJsonWriter Writer;
+        Writer.BeginObject();
+        Writer->WriteValue(TEXT("actor"), Container->GetName());
+        Writer->WriteValue(TEXT("component"), Component->GetName());
+        Writer->WriteValue(TEXT("instance_count"), Component->GetInstanceCount());
+        Writer->WriteValue(TEXT("failed"), Instances.Num() - Transforms.Num());
+        return Writer.Finish();
+    }
+}
+
+/**
+ * 批量生成Actor
+ * 以"class"或"blueprint"为模板，按"instances"中的变换/属性逐个延迟生成(FinishSpawning前写入属性，构造脚本只运行一次)
+ * 整批在一个事务中完成，最后统一标脏关卡并刷新视口；"mode": "instanced"时改为写入一个ISM组件
+ */
+FJsonObjectParameter UMCPEditorTools::HandleBulkSpawnActors(const FJsonObjectParameter& Params)
+{
+    const TArray<TSharedPtr<FJsonValue>>* Instances = nullptr;
+    if (!Params->TryGetArrayField(TEXT("instances"), Instances))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'instances' parameter"));
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    bool bTransaction = true;
+    Params->TryGetBoolField(TEXT("transaction"), bTransaction);
+    FString TransactionName = TEXT("MCP Bulk Spawn");
+    Params->TryGetStringField(TEXT("transaction_name"), TransactionName);
+    FScopedTransaction Transaction(FText::FromString(TransactionName), bTransaction);
+
+    FString Mode;
+    if (Params->TryGetStringField(TEXT("mode"), Mode) && Mode.Equals(TEXT("instanced"), ESearchCase::IgnoreCase))
+    {
+        return MCPBulkSpawn::SpawnInstanced(World, Params, *Instances);
+    }
+
+    // 解析模板类：类名/类路径，或蓝图名/蓝图路径
+    const UClass* ActorClass = nullptr;
+    FString ClassName;
+    FString BlueprintName;
+    if (Params->TryGetStringField(TEXT("class"), ClassName))
+    {
+        FString ClassError;
+        ActorClass = FMCPSymbolIndex::Get().FindClass(ClassName, AActor::StaticClass(), ClassError);
+        if (!ActorClass)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(ClassError);
+        }
+    }
+    else if (Params->TryGetStringField(TEXT("blueprint"), BlueprintName))
+    {
+        FString BlueprintError;
+        UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName, BlueprintError);
+        if (!Blueprint)
+        {
+            return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
+        }
+        ActorClass = Blueprint->GeneratedClass.Get();
+    }
+    else
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'class' or 'blueprint' parameter"));
+    }
+    if (!ActorClass || !ActorClass->IsChildOf(AActor::StaticClass()))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor class not found: %s"), ClassName.IsEmpty() ? *BlueprintName : *ClassName));
+    }
+
+    const TSharedPtr<FJsonObject>* SharedProperties = nullptr;
+    Params->TryGetObjectField(TEXT("properties"), SharedProperties);
+    FString Folder;
+    Params->TryGetStringField(TEXT("folder"), Folder);
+
+    // 只记录撤销，不标脏；有Actor生成成功后才统一标脏
+    ULevel* Level = World->GetCurrentLevel();
+    Level->Modify(false);
+
+    FMCPJsonWriter Writer(Instances->Num() * 48);
+    Writer.BeginObject();
+    Writer->WriteArrayStart(TEXT("results"));
+
+    // Spawned: 实际生成的Actor数(决定是否标脏)；Failed: 结果中success=false的项数(含属性写入失败但Actor已生成的项)
+    int32 Spawned = 0;
+    int32 Failed = 0;
+    for (int32 Index = 0; Index < Instances->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* Item = nullptr;
+        if (!(*Instances)[Index]->TryGetObject(Item))
+        {
+            MCPBulkEdit::WriteItemResult(Writer.Get(), Index, FString(), TEXT("Instance must be an object"));
+            ++Failed;
+            continue;
+        }
+
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.bDeferConstruction = true;
+        SpawnParams.ObjectFlags |= RF_Transactional;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        FString ActorName;
+        if ((*Item)->TryGetStringField(TEXT("name"), ActorName) && !ActorName.IsEmpty())
+        {
+            if (FMCPActorIndex::Get().FindByName(FName(*ActorName)))
+            {
+                MCPBulkEdit::WriteItemResult(Writer.Get(), Index, ActorName, FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
+                ++Failed;
+                continue;
+            }
+            SpawnParams.Name = *ActorName;
+        }
+
+        // 等同于SpawnActorDeferred，但保留对名称的控制
+        const FTransform Transform = MCPBulkSpawn::ReadTransform(*Item);
+        AActor* Actor = World->SpawnActor(const_cast<UClass*>(ActorClass), &Transform, SpawnParams);
+        if (!Actor)
+        {
+            MCPBulkEdit::WriteItemResult(Writer.Get(), Index, ActorName, TEXT("Failed to spawn actor"));
+            ++Failed;
+            continue;
+        }
+
+        // 构造脚本运行之前写入共享属性和实例属性
+        FString Error;
+        MCPBulkSpawn::ApplyProperties(Actor, SharedProperties, Error);
+        const TSharedPtr<FJsonObject>* Properties = nullptr;
+        if ((*Item)->TryGetObjectField(TEXT("properties"), Properties))
+        {
+            MCPBulkSpawn::ApplyProperties(Actor, Properties, Error);
+        }
+        Actor->FinishSpawning(Transform);
+
+        if (!Folder.IsEmpty())
+        {
+            Actor->SetFolderPath(FName(*Folder));
+        }
+        ++Spawned;
+        if (!Error.IsEmpty())
+        {
+            ++Failed;
+        }
+        MCPBulkEdit::WriteItemResult(Writer.Get(), Index, Actor->GetName(), Error);
+    }
+    Writer->WriteArrayEnd();
+
+    // 整批只标脏/刷新一次
+    if (Spawned > 0)
+    {
+        Level->MarkPackageDirty();
+        GEditor->RedrawLevelEditingViewports();
+    }
+
+    Writer->WriteValue(TEXT("spawned"), Spawned);
+    Writer->WriteValue(TEXT("failed"), Failed);
+    return Writer.Finish();
+}
+
+/**
+ * 保存Actor快照
+ * 每个Actor和组件序列化到内存中的二进制缓冲区(对象引用按路径保存)，快照保存在按最近使用淘汰的缓存中
+ */
+FJsonObjectParameter UMCPEditorTools::HandleSnapshotActors(const FJsonObjectParameter& Params)
+{
+    TArray<AActor*> Actors;
+    const TArray<TSharedPtr<FJsonValue>>* Names = nullptr;
+    if (Params->TryGetArrayField(TEXT("actors"), Names))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *Names)
+        {
+            FString Name;
+            if (!Value.IsValid() || !Value->TryGetString(Name))
+            {
+                continue;
+            }
+            AActor* Actor = FMCPActorIndex::Get().FindActor(Name);
+            if (!Actor)
+            {
+                return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *Name));
+            }
+            Actors.AddUnique(Actor);
+        }
+    }
+    else if (GEditor)
+    {
+        // 未指定时使用当前选中的Actor
+        for (FSelectionIterator It(GEditor->GetSelectedActorIterator()); It; ++It)
+        {
+            if (AActor* Actor = Cast<AActor>(*It))
+            {
+                Actors.Add(Actor);
+            }
+        }
+    }
+
+    if (Actors.IsEmpty())
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No actors to snapshot: pass 'actors' or select some in the editor"));
+    }
+
+    const FString Id = FMCPSnapshotStore::Get().Capture(Actors);
+
+    TArray<TSharedRef<const FMCPSnapshotStore::FSnapshot>> Snapshots;
+    FMCPSnapshotStore::Get().GetSnapshots(Snapshots);
+
+    FMCPJsonWriter Writer;
+    Writer.BeginSuccessResponse();
+    Writer->WriteValue(TEXT("snapshot_id"), Id);
+    Writer->WriteArrayStart(TEXT("actors"));
+    for (AActor* Actor : Actors)
+    {
+        Writer->WriteValue(Actor->GetName());
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteValue(TEXT("bytes"), Snapshots[0]->Bytes);
+    Writer->WriteValue(TEXT("snapshots"), Snapshots.Num());
+    return Writer.Finish();
+}
+
+/**
+ * 恢复Actor快照
+ * 整个恢复过程在一个事务中完成，之后仍可用编辑器撤销
+ */
+FJsonObjectParameter UMCPEditorTools::HandleRestoreSnapshot(const FJsonObjectParameter& Params)
+{
+    FString Id;
+    if (!Params->TryGetStringField(TEXT("snapshot_id"), Id))
+    {
+        return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'snapshot_id' parameter"));
+    }
+
+    bool bTransaction = true;
+    Params->TryGetBoolField(TEXT("transaction"), bTransaction);
+    FString TransactionName = TEXT("MCP Restore Snapshot");
+    Params->TryGetStringField(TEXT("transaction_name"), TransactionName);
+
+    TArray<AActor*> Restored;
+    TArray<FString> Missing;
+    FString Error;
+    {
+        FScopedTransaction Transaction(FText::FromString(TransactionName), bTransaction);
+        if (!FMCPSnapshotStore::Get().Restore(Id, Restored, Missing, Error))
+        {
+            Transaction.Cancel();
+            return FUnrealMCPCommonUtils::CreateErrorResponse(Error);
+        }
+    }
+
+    // 标签、变换和属性都可能被恢复，刷新名称索引；空间索引和变更日志已由Restore中的PostEditMove/PostEditChange通知
+    if (!Restored.IsEmpty())
+    {
+        FMCPActorIndex::Get().Invalidate();
+    }
+
+    bool bDiscard = false;
+    Params->TryGetBoolField(TEXT("discard"), bDiscard);
+    if (bDiscard)
+    {
+        FMCPSnapshotStore::Get().Remove(Id);
+    }
+
+    FMCPJsonWriter Writer;
+    Writer.BeginSuccessResponse();
+    Writer->WriteValue(TEXT("snapshot_id"), Id);
+    Writer->WriteArrayStart(TEXT("restored"));
+    for (AActor* Actor : Restored)
+    {
+        Writer->WriteValue(Actor->GetName());
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteArrayStart(TEXT("missing"));
+    for (const FString& Path : Missing)
+    {
+        Writer->WriteValue(Path);
+    }
+    Writer->WriteArrayEnd();
+    return Writer.Finish();
+}
+
 /**
  * 设置编辑器视口的焦点
  * 可以聚焦到指定Actor或坐标位置
@@ -510,18 +1392,7 @@ FJsonObjectParameter UMCPEditorTools::HandleFocusViewport(const FJsonObjectParam
     if (HasTargetActor)
     {
         // 查找Actor
-        AActor* TargetActor = nullptr;
-        TArray<AActor*> AllActors;
-        UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-
-        for (AActor* Actor : AllActors)
-        {
-            if (Actor && Actor->GetName() == TargetActorName)
-            {
-                TargetActor = Actor;
-                break;
-            }
-        }
+        AActor* TargetActor = FMCPActorIndex::Get().FindActor(TargetActorName);
 
         if (!TargetActor)
         {
@@ -604,9 +1475,16 @@ FJsonObjectParameter UMCPEditorTools::HandleTakeScreenshot(const FJsonObjectPara
 
 FJsonObjectParameter UMCPEditorTools::ConvertObjectToJson(UObject* TargetObject)
 {
-	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-	FJsonObjectConverter::UStructToJsonObject(TargetObject->GetClass(),TargetObject,ResultObj.ToSharedRef());
-	return {ResultObj};
+	if (!TargetObject)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Invalid object"));
+	}
+
+	// 直接把反射属性流式写入json，不再经过FJsonObjectConverter的DOM
+	FMCPJsonWriter Writer;
+	Writer.BeginObject();
+	FMCPPropertyCodec::Get().WriteMembers(Writer.Get(), TargetObject->GetClass(), TargetObject);
+	return Writer.Finish();
 }
 
 
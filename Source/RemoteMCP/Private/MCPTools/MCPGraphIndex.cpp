@@ -0,0 +1,313 @@
+#include "MCPTools/MCPGraphIndex.h"
+
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+
+namespace MCPGraphIndex
+{
+	// graphs are touched a few at a time; past this the tables of graphs no longer in use are dropped together
+	static constexpr int32 MaxGraphs = 64;
+
+	/** Node and pin names are matched as FNames; a name nobody has registered cannot be on any node. */
+	static FName FindName(const FString& Name)
+	{
+		return Name.IsEmpty() ? NAME_None : FName(*Name, FNAME_Find);
+	}
+
+	static UEdGraphNode* ScanNodes(const UEdGraph* Graph, const FGuid& Guid, FName Name)
+	{
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (Node && ((Guid.IsValid() && Node->NodeGuid == Guid) || (!Name.IsNone() && Node->GetFName() == Name)))
+			{
+				return Node;
+			}
+		}
+		return nullptr;
+	}
+
+	static UEdGraphPin* ScanPins(const UEdGraphNode* Node, FName Name, EEdGraphPinDirection Direction)
+	{
+		for (UEdGraphPin* Pin : Node->Pins)
+		{
+			if (Pin && Pin->PinName == Name && (Direction == EGPD_MAX || Pin->Direction == Direction))
+			{
+				return Pin;
+			}
+		}
+		return nullptr;
+	}
+}
+
+FMCPGraphIndex& FMCPGraphIndex::Get()
+{
+	static FMCPGraphIndex Index;
+	return Index;
+}
+
+void FMCPGraphIndex::Shutdown()
+{
+	Reset();
+}
+
+UEdGraphNode* FMCPGraphIndex::FindNode(UEdGraph* Graph, const FString& Guid, const FString& Name)
+{
+	FGuid ParsedGuid;
+	if (!Guid.IsEmpty())
+	{
+		FGuid::Parse(Guid, ParsedGuid);
+	}
+	const FName NodeName = MCPGraphIndex::FindName(Name);
+	if (!Graph || (!ParsedGuid.IsValid() && NodeName.IsNone()))
+	{
+		return nullptr;
+	}
+
+	if (!IsInGameThread())
+	{
+		return MCPGraphIndex::ScanNodes(Graph, ParsedGuid, NodeName);
+	}
+
+	FGraphTables& Tables = GetTables(Graph);
+	for (int32 Attempt = 0; Attempt < 2; ++Attempt)
+	{
+		const bool bFresh = !Tables.bBuilt;
+		if (bFresh)
+		{
+			Build(Tables);
+		}
+
+		// a hit must still be what it was indexed as: removed, renamed and re-guided nodes fail here
+		if (ParsedGuid.IsValid())
+		{
+			const TWeakObjectPtr<UEdGraphNode>* Found = Tables.ByGuid.Find(ParsedGuid);
+			UEdGraphNode* Node = Found ? Found->Get() : nullptr;
+			if (IsValid(Node) && Node->GetGraph() == Graph && Node->NodeGuid == ParsedGuid)
+			{
+				return Node;
+			}
+		}
+		if (!NodeName.IsNone())
+		{
+			const TWeakObjectPtr<UEdGraphNode>* Found = Tables.ByName.Find(NodeName);
+			UEdGraphNode* Node = Found ? Found->Get() : nullptr;
+			if (IsValid(Node) && Node->GetGraph() == Graph && Node->GetFName() == NodeName)
+			{
+				return Node;
+			}
+		}
+		if (bFresh)
+		{
+			break;
+		}
+		// stale or missing: the graph may have been edited without a notification
+		Tables.bBuilt = false;
+	}
+	return nullptr;
+}
+
+UEdGraphNode* FMCPGraphIndex::FindNodeByPath(const FString& Path, UEdGraph* Graph)
+{
+	if (Path.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	if (Graph && IsInGameThread())
+	{
+		// nodes are direct subobjects of their graph: "<graph path>.<node name>"
+		const FString GraphPath = Graph->GetPathName();
+		if (Path.Len() > GraphPath.Len() + 1 && Path.StartsWith(GraphPath, ESearchCase::CaseSensitive)
+			&& (Path[GraphPath.Len()] == TEXT('.') || Path[GraphPath.Len()] == SUBOBJECT_DELIMITER_CHAR))
+		{
+			if (UEdGraphNode* Node = FindNode(Graph, FString(), Path.RightChop(GraphPath.Len() + 1)))
+			{
+				return Node;
+			}
+		}
+	}
+
+	UObject* Object = StaticFindObject(UEdGraphNode::StaticClass(), nullptr, *Path);
+	if (!Object && IsInGameThread())
+	{
+		// loading is game-thread only; elsewhere only nodes already in memory can be found
+		Object = StaticLoadObject(UEdGraphNode::StaticClass(), nullptr, *Path, nullptr, LOAD_NoWarn);
+	}
+	return Cast<UEdGraphNode>(Object);
+}
+
+UEdGraphPin* FMCPGraphIndex::FindPin(UEdGraphNode* Node, const FString& Name, EEdGraphPinDirection Direction)
+{
+	const FName PinName = MCPGraphIndex::FindName(Name);
+	if (!Node || PinName.IsNone())
+	{
+		return nullptr;
+	}
+
+	UEdGraph* Graph = Node->GetGraph();
+	if (!Graph || !IsInGameThread())
+	{
+		return MCPGraphIndex::ScanPins(Node, PinName, Direction);
+	}
+
+	FGraphTables& Tables = GetTables(Graph);
+	const FPinKey Key{ PinName, Direction };
+	for (int32 Attempt = 0; Attempt < 2; ++Attempt)
+	{
+		TMap<FPinKey, UEdGraphPin*>* NodePins = Tables.Pins.Find(FObjectKey(Node));
+		const bool bFresh = !NodePins;
+		if (bFresh)
+		{
+			NodePins = &Tables.Pins.Add(FObjectKey(Node));
+			for (UEdGraphPin* Pin : Node->Pins)
+			{
+				if (Pin)
+				{
+					// first pin in node order wins, for a given direction and for either direction
+					NodePins->FindOrAdd(FPinKey{ Pin->PinName, Pin->Direction }, Pin);
+					NodePins->FindOrAdd(FPinKey{ Pin->PinName, EGPD_MAX }, Pin);
+				}
+			}
+		}
+
+		UEdGraphPin* const* Found = NodePins->Find(Key);
+		// reconstructing a node replaces its pins without telling the graph; only pins still on the node are returned,
+		// and the pointer is compared before it is dereferenced
+		if (Found && Node->Pins.Contains(*Found) && (*Found)->PinName == PinName)
+		{
+			return *Found;
+		}
+		if (bFresh)
+		{
+			break;
+		}
+		Tables.Pins.Remove(FObjectKey(Node));
+	}
+	return nullptr;
+}
+
+void FMCPGraphIndex::Invalidate(const UEdGraph* Graph)
+{
+	if (TUniquePtr<FGraphTables>* Found = Graphs.Find(FObjectKey(Graph)))
+	{
+		(*Found)->bBuilt = false;
+		(*Found)->Pins.Reset();
+	}
+}
+
+void FMCPGraphIndex::Reset()
+{
+	for (TPair<FObjectKey, TUniquePtr<FGraphTables>>& Pair : Graphs)
+	{
+		Unregister(*Pair.Value);
+	}
+	Graphs.Reset();
+}
+
+FMCPGraphIndex::FGraphTables& FMCPGraphIndex::GetTables(UEdGraph* Graph)
+{
+	const FObjectKey Key(Graph);
+	if (TUniquePtr<FGraphTables>* Found = Graphs.Find(Key))
+	{
+		return **Found;
+	}
+
+	// graphs that were garbage collected cannot notify anymore; their tables are dead weight
+	for (auto It = Graphs.CreateIterator(); It; ++It)
+	{
+		if (!It.Value()->Graph.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	if (Graphs.Num() >= MCPGraphIndex::MaxGraphs)
+	{
+		Reset();
+	}
+
+	TUniquePtr<FGraphTables>& Tables = Graphs.Add(Key, MakeUnique<FGraphTables>());
+	Tables->Graph = Graph;
+	Tables->ChangedHandle = Graph->AddOnGraphChangedHandler(FOnGraphChanged::FDelegate::CreateRaw(this, &FMCPGraphIndex::OnGraphChanged, Key));
+	return *Tables;
+}
+
+void FMCPGraphIndex::Build(FGraphTables& Tables)
+{
+	Tables.ByGuid.Reset();
+	Tables.ByName.Reset();
+	Tables.Pins.Reset();
+	if (const UEdGraph* Graph = Tables.Graph.Get())
+	{
+		Tables.ByGuid.Reserve(Graph->Nodes.Num());
+		Tables.ByName.Reserve(Graph->Nodes.Num());
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (Node)
+			{
+				// first node in graph order wins, as a scan would
+				Tables.ByGuid.FindOrAdd(Node->NodeGuid, Node);
+				Tables.ByName.FindOrAdd(Node->GetFName(), Node);
+			}
+		}
+	}
+	Tables.bBuilt = true;
+}
+
+void FMCPGraphIndex::OnGraphChanged(const FEdGraphEditAction& Action, FObjectKey GraphKey)
+{
+	TUniquePtr<FGraphTables>* Found = Graphs.Find(GraphKey);
+	if (!Found)
+	{
+		return;
+	}
+	FGraphTables& Tables = **Found;
+
+	// a plain NotifyGraphChanged() says nothing about what changed
+	const int32 NodeActions = GRAPHACTION_AddNode | GRAPHACTION_RemoveNode | GRAPHACTION_EditNode;
+	if (Action.Action == GRAPHACTION_Default || Action.Nodes.IsEmpty() || (Action.Action & ~(NodeActions | GRAPHACTION_SelectNode)) != 0)
+	{
+		Tables.bBuilt = false;
+		Tables.Pins.Reset();
+		return;
+	}
+
+	// node edits are applied in place, so a run of adds and removes does not rebuild the tables once per edit
+	for (const UEdGraphNode* Node : Action.Nodes)
+	{
+		if (!Node)
+		{
+			continue;
+		}
+		Tables.Pins.Remove(FObjectKey(Node));
+		if (!Tables.bBuilt)
+		{
+			continue;
+		}
+		if (Action.Action & GRAPHACTION_RemoveNode)
+		{
+			if (const TWeakObjectPtr<UEdGraphNode>* Indexed = Tables.ByGuid.Find(Node->NodeGuid); Indexed && Indexed->Get() == Node)
+			{
+				Tables.ByGuid.Remove(Node->NodeGuid);
+			}
+			if (const TWeakObjectPtr<UEdGraphNode>* Indexed = Tables.ByName.Find(Node->GetFName()); Indexed && Indexed->Get() == Node)
+			{
+				Tables.ByName.Remove(Node->GetFName());
+			}
+		}
+		else if (Action.Action & GRAPHACTION_AddNode)
+		{
+			// as in Build, an earlier node with the same guid or name keeps the entry
+			UEdGraphNode* MutableNode = const_cast<UEdGraphNode*>(Node);
+			Tables.ByGuid.FindOrAdd(Node->NodeGuid, MutableNode);
+			Tables.ByName.FindOrAdd(Node->GetFName(), MutableNode);
+		}
+	}
+}
+
+void FMCPGraphIndex::Unregister(FGraphTables& Tables)
+{
+	if (UEdGraph* Graph = Tables.Graph.Get())
+	{
+		Graph->RemoveOnGraphChangedHandler(Tables.ChangedHandle);
+	}
+}
@@ -0,0 +1,71 @@
+#include "MCPTools/MCPJsonWriter.h"
+
+#include "Serialization/JsonSerializer.h"
+
+FMCPJsonWriter::FMCPJsonWriter(int32 ReserveChars)
+	: Writer(TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Buffer))
+{
+	if (ReserveChars > 0)
+	{
+		Buffer.Reserve(ReserveChars);
+	}
+}
+
+void FMCPJsonWriter::BeginObject()
+{
+	Writer->WriteObjectStart();
+	++OpenScopes;
+}
+
+void FMCPJsonWriter::BeginSuccessResponse()
+{
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("success"), true);
+	Writer->WriteObjectStart(TEXT("data"));
+	OpenScopes += 2;
+}
+
+FJsonObjectParameter FMCPJsonWriter::Finish()
+{
+	for (; OpenScopes > 0; --OpenScopes)
+	{
+		Writer->WriteObjectEnd();
+	}
+	Writer->Close();
+	return FJsonObjectParameter::FromSerializedString(MoveTemp(Buffer));
+}
+
+void FMCPJsonWriter::WriteJsonValue(const FString& Identifier, const TSharedPtr<FJsonValue>& Value)
+{
+	if (Value.IsValid())
+	{
+		FJsonSerializer::Serialize(Value, Identifier, Writer, false);
+	}
+	else
+	{
+		Writer->WriteNull(Identifier);
+	}
+}
+
+void FMCPJsonWriter::WriteJsonObject(const FString& Identifier, const TSharedPtr<FJsonObject>& Object)
+{
+	WriteJsonValue(Identifier, Object.IsValid() ? MakeShared<FJsonValueObject>(Object) : TSharedPtr<FJsonValue>());
+}
+
+void FMCPJsonWriter::WriteVector(FWriter& Writer, const FString& Identifier, const FVector& Value)
+{
+	Writer.WriteArrayStart(Identifier);
+	Writer.WriteValue(Value.X);
+	Writer.WriteValue(Value.Y);
+	Writer.WriteValue(Value.Z);
+	Writer.WriteArrayEnd();
+}
+
+void FMCPJsonWriter::WriteRotator(FWriter& Writer, const FString& Identifier, const FRotator& Value)
+{
+	Writer.WriteArrayStart(Identifier);
+	Writer.WriteValue(Value.Pitch);
+	Writer.WriteValue(Value.Yaw);
+	Writer.WriteValue(Value.Roll);
+	Writer.WriteArrayEnd();
+}
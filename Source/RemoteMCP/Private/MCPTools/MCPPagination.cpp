@@ -0,0 +1,159 @@
+#include "MCPTools/MCPPagination.h"
+
+#include "Misc/Base64.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+	constexpr TCHAR CursorSeparator = TEXT('\n');
+
+	/** Paging controls; every other parameter shapes the listing and is bound into the cursor. */
+	bool IsPagingField(const FString& Field)
+	{
+		return Field == TEXT("limit") || Field == TEXT("cursor") || Field == TEXT("response_format");
+	}
+
+	/** Hash of the query parameters, independent of the order the caller sent them in. */
+	FString HashQuery(const FJsonObject& Params)
+	{
+		TArray<FString> Keys;
+		Params.Values.GetKeys(Keys);
+		Keys.Sort();
+
+		FString Canonical;
+		for (const FString& Key : Keys)
+		{
+			if (IsPagingField(Key))
+			{
+				continue;
+			}
+			FString Value;
+			TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Value);
+			FJsonSerializer::Serialize(Params.Values[Key], TEXT(""), Writer);
+			Canonical += Key;
+			Canonical += TEXT('=');
+			Canonical += Value;
+			Canonical += CursorSeparator;
+		}
+		return FString::Printf(TEXT("%08x"), FCrc::StrCrc32(*Canonical));
+	}
+}
+
+void FMCPFieldMask::Parse(const FJsonObject& Params)
+{
+	Fields.Reset();
+
+	const TArray<TSharedPtr<FJsonValue>>* FieldArray = nullptr;
+	if (Params.TryGetArrayField(TEXT("fields"), FieldArray))
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *FieldArray)
+		{
+			FString Field;
+			if (Value.IsValid() && Value->TryGetString(Field) && !Field.TrimStartAndEnd().IsEmpty())
+			{
+				Fields.AddUnique(Field.TrimStartAndEnd());
+			}
+		}
+		return;
+	}
+
+	FString FieldList;
+	if (Params.TryGetStringField(TEXT("fields"), FieldList))
+	{
+		TArray<FString> Parts;
+		FieldList.ParseIntoArray(Parts, TEXT(","), true);
+		for (const FString& Part : Parts)
+		{
+			FString Field = Part.TrimStartAndEnd();
+			if (!Field.IsEmpty())
+			{
+				Fields.AddUnique(MoveTemp(Field));
+			}
+		}
+	}
+}
+
+void FMCPFieldMask::Project(FJsonObject& Object) const
+{
+	if (Fields.IsEmpty())
+	{
+		return;
+	}
+	for (auto It = Object.Values.CreateIterator(); It; ++It)
+	{
+		if (!Fields.Contains(It->Key))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool FMCPPageRequest::Parse(const FJsonObjectParameter& Params, const TCHAR* InScope, FString& OutError)
+{
+	Scope = InScope;
+
+	double LimitD = 0.0;
+	if (Params->TryGetNumberField(TEXT("limit"), LimitD))
+	{
+		Limit = FMath::Max(0, (int32)LimitD);
+	}
+
+	if (Params.GetJsonObject().IsValid())
+	{
+		Fields.Parse(*Params.GetJsonObject());
+		QueryHash = HashQuery(*Params.GetJsonObject());
+	}
+
+	FString Cursor;
+	if (!Params->TryGetStringField(TEXT("cursor"), Cursor) || Cursor.IsEmpty())
+	{
+		return true;
+	}
+
+	FString Decoded;
+	FString CursorScope;
+	FString CursorQuery;
+	FString Rest;
+	if (!FBase64::Decode(Cursor, Decoded) || !Decoded.Split(FString(1, &CursorSeparator), &CursorScope, &Rest)
+		|| !Rest.Split(FString(1, &CursorSeparator), &CursorQuery, &After) || CursorScope != Scope)
+	{
+		OutError = FString::Printf(TEXT("Invalid cursor for %s listing"), *Scope);
+		return false;
+	}
+	if (CursorQuery != QueryHash)
+	{
+		OutError = FString::Printf(TEXT("Cursor belongs to a %s listing with different parameters; only limit may change between pages"), *Scope);
+		return false;
+	}
+	bHasCursor = true;
+	return true;
+}
+
+void FMCPPageRequest::Finish(int32 InTotal, int32 End, const FString& LastKey)
+{
+	Total = InTotal;
+	NextCursor.Reset();
+	if (End < InTotal && !LastKey.IsEmpty())
+	{
+		NextCursor = FBase64::Encode(Scope + CursorSeparator + QueryHash + CursorSeparator + LastKey);
+	}
+}
+
+void FMCPPageRequest::WritePageInfo(FMCPJsonWriter::FWriter& Writer) const
+{
+	Writer.WriteValue(TEXT("total"), Total);
+	if (!NextCursor.IsEmpty())
+	{
+		Writer.WriteValue(TEXT("next_cursor"), NextCursor);
+	}
+}
+
+void FMCPPageRequest::SetPageInfo(FJsonObject& Object) const
+{
+	Object.SetNumberField(TEXT("total"), Total);
+	if (!NextCursor.IsEmpty())
+	{
+		Object.SetStringField(TEXT("next_cursor"), NextCursor);
+	}
+}
@@ -0,0 +1,954 @@
+#include "MCPTools/MCPPropertyCodec.h"
+
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Internationalization/Text.h"
+#include "Misc/PackageName.h"
+#include "UObject/SoftObjectPtr.h"
+#include "UObject/UnrealType.h"
+
+namespace MCPPropertyCodec
+{
+	using FWriter = FMCPPropertyCodec::FWriter;
+
+	/** Default-initialized scratch value for a property, e.g. a map key or set element before it is inserted. */
+	struct FScopedValue
+	{
+		explicit FScopedValue(const FProperty* InProperty)
+			: Property(InProperty)
+			, Data(FMemory::Malloc(InProperty->GetSize(), InProperty->GetMinAlignment()))
+		{
+			Property->InitializeValue(Data);
+		}
+
+		~FScopedValue()
+		{
+			Property->DestroyValue(Data);
+			FMemory::Free(Data);
+		}
+
+		FScopedValue(const FScopedValue&) = delete;
+		FScopedValue& operator=(const FScopedValue&) = delete;
+
+		const FProperty* Property;
+		void* Data;
+	};
+
+	static bool ImportText(const FProperty* Property, void* Value, const FString& Text, UObject* Owner, FString& OutError)
+	{
+		if (Property->ImportText_Direct(*Text, Value, Owner, PPF_None))
+		{
+			return true;
+		}
+		OutError = FString::Printf(TEXT("Could not parse '%s' as %s"), *Text, *Property->GetCPPType());
+		return false;
+	}
+
+	static bool TypeError(const FProperty* Property, const FJsonValue& Json, FString& OutError)
+	{
+		static const TCHAR* JsonTypeNames[] = { TEXT("none"), TEXT("null"), TEXT("string"), TEXT("number"), TEXT("boolean"), TEXT("array"), TEXT("object") };
+		const int32 TypeIndex = static_cast<int32>(Json.Type);
+		OutError = FString::Printf(TEXT("Cannot assign a json %s to %s"),
+			TypeIndex < UE_ARRAY_COUNT(JsonTypeNames) ? JsonTypeNames[TypeIndex] : TEXT("value"), *Property->GetCPPType());
+		return false;
+	}
+
+	static bool ResolveEnumValue(const UEnum* Enum, const FJsonValue& Json, int64& OutValue, FString& OutError)
+	{
+		if (Json.Type == EJson::Number)
+		{
+			OutValue = static_cast<int64>(Json.AsNumber());
+			return true;
+		}
+		if (Json.Type != EJson::String)
+		{
+			OutError = FString::Printf(TEXT("Enum %s requires a name or an integer"), *Enum->GetName());
+			return false;
+		}
+
+		FString Name = Json.AsString();
+		if (Name.IsNumeric())
+		{
+			OutValue = FCString::Atoi64(*Name);
+			return true;
+		}
+
+		// "Player0" or "EAutoReceiveInput::Player0"
+		FString ShortName = Name;
+		if (ShortName.Contains(TEXT("::")))
+		{
+			ShortName.Split(TEXT("::"), nullptr, &ShortName);
+		}
+		OutValue = Enum->GetValueByNameString(ShortName);
+		if (OutValue == INDEX_NONE)
+		{
+			OutValue = Enum->GetValueByNameString(Name);
+		}
+		if (OutValue != INDEX_NONE)
+		{
+			return true;
+		}
+
+		TArray<FString> Options;
+		// the last entry is the implicit _MAX
+		for (int32 Index = 0; Index < Enum->NumEnums() - 1; ++Index)
+		{
+			Options.Add(Enum->GetNameStringByIndex(Index));
+		}
+		OutError = FString::Printf(TEXT("Could not find enum value for '%s'. Available options: %s"), *ShortName, *FString::Join(Options, TEXT(", ")));
+		return false;
+	}
+
+	static void WriteEnum(FWriter& Writer, const UEnum* Enum, int64 Value)
+	{
+		const FString Name = Enum->GetNameStringByValue(Value);
+		if (Name.IsEmpty())
+		{
+			Writer.WriteValue(Value);
+		}
+		else
+		{
+			Writer.WriteValue(Name);
+		}
+	}
+
+	/** Json object keys for map keys that have a natural string form; other key types use a list of pairs. */
+	static bool HasStringKey(const FProperty* KeyProperty)
+	{
+		return KeyProperty->IsA<FStrProperty>() || KeyProperty->IsA<FNameProperty>() || KeyProperty->IsA<FTextProperty>()
+			|| KeyProperty->IsA<FEnumProperty>() || KeyProperty->IsA<FNumericProperty>() || KeyProperty->IsA<FBoolProperty>();
+	}
+
+	static FString KeyToString(const FProperty* KeyProperty, const void* Key)
+	{
+		if (const FStrProperty* StrProperty = CastField<FStrProperty>(KeyProperty))
+		{
+			return StrProperty->GetPropertyValue(Key);
+		}
+		if (const FNameProperty* NameProperty = CastField<FNameProperty>(KeyProperty))
+		{
+			return NameProperty->GetPropertyValue(Key).ToString();
+		}
+		if (const FTextProperty* TextProperty = CastField<FTextProperty>(KeyProperty))
+		{
+			return TextProperty->GetPropertyValue(Key).ToString();
+		}
+		if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(KeyProperty))
+		{
+			return BoolProperty->GetPropertyValue(Key) ? TEXT("true") : TEXT("false");
+		}
+		if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(KeyProperty))
+		{
+			const int64 Value = EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(Key);
+			const FString Name = EnumProperty->GetEnum()->GetNameStringByValue(Value);
+			return Name.IsEmpty() ? LexToString(Value) : Name;
+		}
+		const FNumericProperty* NumericProperty = CastFieldChecked<FNumericProperty>(KeyProperty);
+		if (const UEnum* Enum = NumericProperty->GetIntPropertyEnum())
+		{
+			const int64 Value = NumericProperty->GetSignedIntPropertyValue(Key);
+			const FString Name = Enum->GetNameStringByValue(Value);
+			return Name.IsEmpty() ? LexToString(Value) : Name;
+		}
+		return NumericProperty->IsFloatingPoint()
+			? FString::SanitizeFloat(NumericProperty->GetFloatingPointPropertyValue(Key))
+			: LexToString(NumericProperty->GetSignedIntPropertyValue(Key));
+	}
+
+	/** Fill Count doubles from a json number array of exactly that length. */
+	static bool ReadNumbers(const FProperty* Property, const FJsonValue& Json, double* Out, int32 Count, FString& OutError)
+	{
+		const TArray<TSharedPtr<FJsonValue>>& Elements = Json.AsArray();
+		if (Elements.Num() != Count)
+		{
+			OutError = FString::Printf(TEXT("%s requires %d values, got %d"), *Property->GetCPPType(), Count, Elements.Num());
+			return false;
+		}
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			if (!Elements[Index].IsValid() || !Elements[Index]->TryGetNumber(Out[Index]))
+			{
+				OutError = FString::Printf(TEXT("%s requires numbers"), *Property->GetCPPType());
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static void WriteNumbers(FWriter& Writer, std::initializer_list<double> Values)
+	{
+		Writer.WriteArrayStart();
+		for (double Value : Values)
+		{
+			Writer.WriteValue(Value);
+		}
+		Writer.WriteArrayEnd();
+	}
+
+	// ---- scalars ----
+
+	static void WriteBool(const FMCPPropertyCodec&, FWriter& Writer, const FProperty* Property, const void* Value)
+	{
+		Writer.WriteValue(CastFieldChecked<FBoolProperty>(Property)->GetPropertyValue(Value));
+	}
+
+	static bool ReadBool(const FMCPPropertyCodec&, const FProperty* Property, void* Value, const FJsonValue& Json, UObject*, FString& OutError)
+	{
+		bool bValue = false;
+		if (Json.Type == EJson::Boolean || Json.Type == EJson::Number || Json.Type == EJson::String)
+		{
+			if (Json.Type == EJson::Number)
+			{
+				bValue = Json.AsNumber() != 0.0;
+			}
+			else if (Json.Type == EJson::String)
+			{
+				bValue = Json.AsString().ToBool();
+			}
+			else
+			{
+				bValue = Json.AsBool();
+			}
+			CastFieldChecked<FBoolProperty>(Property)->SetPropertyValue(Value, bValue);
+			return true;
+		}
+		return TypeError(Property, Json, OutError);
+	}
+
+	static void WriteNumeric(const FMCPPropertyCodec&, FWriter& Writer, const FProperty* Property, const void* Value)
+	{
+		const FNumericProperty* NumericProperty = CastFieldChecked<FNumericProperty>(Property);
+		if (const UEnum* Enum = NumericProperty->GetIntPropertyEnum())
+		{
+			WriteEnum(Writer, Enum, NumericProperty->GetSignedIntPropertyValue(Value));
+		}
+		else if (NumericProperty->IsFloatingPoint())
+		{
+			Writer.WriteValue(NumericProperty->GetFloatingPointPropertyValue(Value));
+		}
+		else
+		{
+			Writer.WriteValue(NumericProperty->GetSignedIntPropertyValue(Value));
+		}
+	}
+
+	static bool ReadNumeric(const FMCPPropertyCodec&, const FProperty* Property, void* Value, const FJsonValue& Json, UObject*, FString& OutError)
+	{
+		const FNumericProperty* NumericProperty = CastFieldChecked<FNumericProperty>(Property);
+		// TEnumAsByte properties are byte properties with an associated enum
+		if (const UEnum* Enum = NumericProperty->GetIntPropertyEnum())
+		{
+			int64 EnumValue = 0;
+			if (!ResolveEnumValue(Enum, Json, EnumValue, OutError))
+			{
+				return false;
+			}
+			NumericProperty->SetIntPropertyValue(Value, EnumValue);
+			return true;
+		}
+
+		double Number = 0.0;
+		if (Json.Type == EJson::String)
+		{
+			if (!LexTryParseString(Number, *Json.AsString()))
+			{
+				OutError = FString::Printf(TEXT("'%s' is not a number"), *Json.AsString());
+				return false;
+			}
+		}
+		else if (Json.Type == EJson::Number || Json.Type == EJson::Boolean)
+		{
+			Json.TryGetNumber(Number);
+		}
+		else
+		{
+			return TypeError(Property, Json, OutError);
+		}
+
+		if (NumericProperty->IsFloatingPoint())
+		{
+			NumericProperty->SetFloatingPointPropertyValue(Value, Number);
+		}
+		else
+		{
+			NumericProperty->SetIntPropertyValue(Value, static_cast<int64>(Number));
+		}
+		return true;
+	}
+
+	static void WriteEnumProperty(const FMCPPropertyCodec&, FWriter& Writer, const FProperty* Property, const void* Value)
+	{
+		const FEnumProperty* EnumProperty = CastFieldChecked<FEnumProperty>(Property);
+		WriteEnum(Writer, EnumProperty->GetEnum(), EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(Value));
+	}
+
+	static bool ReadEnumProperty(const FMCPPropertyCodec&, const FProperty* Property, void* Value, const FJsonValue& Json, UObject*, FString& OutError)
+	{
+		const FEnumProperty* EnumProperty = CastFieldChecked<FEnumProperty>(Property);
+		int64 EnumValue = 0;
+		if (!ResolveEnumValue(EnumProperty->GetEnum(), Json, EnumValue, OutError))
+		{
+			return false;
+		}
+		EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(Value, EnumValue);
+		return true;
+	}
+
+	static void WriteStr(const FMCPPropertyCodec&, FWriter& Writer, const FProperty* Property, const void* Value)
+	{
+		Writer.WriteValue(CastFieldChecked<FStrProperty>(Property)->GetPropertyValue(Value));
+	}
+
+	static bool ReadStr(const FMCPPropertyCodec&, const FProperty* Property, void* Value, const FJsonValue& Json, UObject*, FString& OutError)
+	{
+		FString String;
+		if (!Json.TryGetString(String))
+		{
+			return TypeError(Property, Json, OutError);
+		}
+		CastFieldChecked<FStrProperty>(Property)->SetPropertyValue(Value, String);
+		return true;
+	}
+
+	static void WriteName(const FMCPPropertyCodec&, FWriter& Writer, const FProperty* Property, const void* Value)
+	{
+		Writer.WriteValue(CastFieldChecked<FNameProperty>(Property)->GetPropertyValue(Value).ToString());
+	}
+
+	static bool ReadName(const FMCPPropertyCodec&, const FProperty* Property, void* Value, const FJsonValue& Json, UObject*, FString& OutError)
+	{
+		FString String;
+		if (!Json.TryGetString(String))
+		{
+			return TypeError(Property, Json, OutError);
+		}
+		CastFieldChecked<FNameProperty>(Property)->SetPropertyValue(Value, FName(*String));
+		return true;
+	}
+
+	// FText goes through the text string format (NSLOCTEXT / LOCTABLE / INVTEXT), which keeps namespace, key, string
+	// table reference and culture invariance; ToString would keep only the display string
+	static void WriteText(const FMCPPropertyCodec&, FWriter& Writer, const FProperty* Property, const void* Value)
+	{
+		FString Buffer;
+		FTextStringHelper::WriteToBuffer(Buffer, CastFieldChecked<FTextProperty>(Property)->GetPropertyValue(Value));
+		Writer.WriteValue(Buffer);
+	}
+
+	static bool ReadText(const FMCPPropertyCodec&, const FProperty* Property, void* Value, const FJsonValue& Json, UObject*, FString& OutError)
+	{
+		FString String;
+		if (!Json.TryGetString(String))
+		{
+			return TypeError(Property, Json, OutError);
+		}
+		FText Text;
+		if (!FTextStringHelper::ReadFromBuffer(*String, Text))
+		{
+			// not in the text string format: a plain display string
+			Text = FText::FromString(String);
+		}
+		CastFieldChecked<FTextProperty>(Property)->SetPropertyValue(Value, Text);
+		return true;
+	}
+
+	// ---- object references ----
+
+	static void WriteObject(const FMCPPropertyCodec&, FWriter& Writer, const FProperty* Property, const void* Value)
+	{
+		if (const UObject* Object = CastFieldChecked<FObjectPropertyBase>(Property)->GetObjectPropertyValue(Value))
+		{
+			Writer.WriteValue(Object->GetPathName());
+		}
+		else
+		{
+			Writer.WriteNull();
+		}
+	}
+
+	static bool ReadObject(const FMCPPropertyCodec&, const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError)
+	{
+		const FObjectPropertyBase* ObjectProperty = CastFieldChecked<FObjectPropertyBase>(Property);
+		FString Path;
+		if (Json.Type == EJson::Null || (Json.TryGetString(Path) && (Path.IsEmpty() || Path == TEXT("None"))))
+		{
+			ObjectProperty->SetObjectPropertyValue(Value, nullptr);
+			return true;
+		}
+		if (Json.Type != EJson::String)
+		{
+			return TypeError(Property, Json, OutError);
+		}
+
+		UObject* Object = StaticFindObject(UObject::StaticClass(), nullptr, *Path);
+		if (!Object && FPackageName::IsValidObjectPath(Path))
+		{
+			Object = StaticLoadObject(ObjectProperty->PropertyClass, nullptr, *Path, nullptr, LOAD_NoWarn);
+		}
+		if (!Object)
+		{
+			// subobject names relative to the owner and other text forms
+			return ImportText(Property, Value, Path, Owner, OutError);
+		}
+
+		if (!Object->IsA(ObjectProperty->PropertyClass))
+		{
+			OutError = FString::Printf(TEXT("%s is a %s, expected %s"), *Path, *Object->GetClass()->GetName(), *ObjectProperty->PropertyClass->GetName());
+			return false;
+		}
+		if (const FClassProperty* ClassProperty = CastField<FClassProperty>(Property))
+		{
+			if (!CastChecked<UClass>(Object)->IsChildOf(ClassProperty->MetaClass))
+			{
+				OutError = FString::Printf(TEXT("%s is not a subclass of %s"), *Path, *ClassProperty->MetaClass->GetName());
+				return false;
+			}
+		}
+		ObjectProperty->SetObjectPropertyValue(Value, Object);
+		return true;
+	}
+
+	static void WriteSoftObject(const FMCPPropertyCodec&, FWriter& Writer, const FProperty* Property, const void* Value)
+	{
+		const FSoftObjectPath& Path = CastFieldChecked<FSoftObjectProperty>(Property)->GetPropertyValue(Value).ToSoftObjectPath();
+		if (Path.IsNull())
+		{
+			Writer.WriteNull();
+		}
+		else
+		{
+			Writer.WriteValue(Path.ToString());
+		}
+	}
+
+	static bool ReadSoftObject(const FMCPPropertyCodec&, const FProperty* Property, void* Value, const FJsonValue& Json, UObject*, FString& OutError)
+	{
+		FString Path;
+		if (Json.Type != EJson::Null && !Json.TryGetString(Path))
+		{
+			return TypeError(Property, Json, OutError);
+		}
+		if (Path == TEXT("None"))
+		{
+			Path.Reset();
+		}
+		CastFieldChecked<FSoftObjectProperty>(Property)->SetPropertyValue(Value, FSoftObjectPtr(FSoftObjectPath(Path)));
+		return true;
+	}
+
+	// ---- containers ----
+
+	static void WriteArray(const FMCPPropertyCodec& Codec, FWriter& Writer, const FProperty* Property, const void* Value)
+	{
+		const FArrayProperty* ArrayProperty = CastFieldChecked<FArrayProperty>(Property);
+		FScriptArrayHelper Helper(ArrayProperty, Value);
+		Writer.WriteArrayStart();
+		for (int32 Index = 0; Index < Helper.Num(); ++Index)
+		{
+			Codec.Write(Writer, ArrayProperty->Inner, Helper.GetRawPtr(Index));
+		}
+		Writer.WriteArrayEnd();
+	}
+
+	static bool ReadArray(const FMCPPropertyCodec& Codec, const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError)
+	{
+		if (Json.Type != EJson::Array)
+		{
+			return TypeError(Property, Json, OutError);
+		}
+		const FArrayProperty* ArrayProperty = CastFieldChecked<FArrayProperty>(Property);
+		const TArray<TSharedPtr<FJsonValue>>& Elements = Json.AsArray();
+
+		FScriptArrayHelper Helper(ArrayProperty, Value);
+		Helper.Resize(Elements.Num());
+		for (int32 Index = 0; Index < Elements.Num(); ++Index)
+		{
+			if (!Codec.Read(ArrayProperty->Inner, Helper.GetRawPtr(Index), Elements[Index], Owner, OutError))
+			{
+				OutError = FString::Printf(TEXT("[%d]: %s"), Index, *OutError);
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static void WriteSet(const FMCPPropertyCodec& Codec, FWriter& Writer, const FProperty* Property, const void* Value)
+	{
+		const FSetProperty* SetProperty = CastFieldChecked<FSetProperty>(Property);
+		FScriptSetHelper Helper(SetProperty, Value);
+		Writer.WriteArrayStart();
+		for (int32 Index = 0; Index < Helper.GetMaxIndex(); ++Index)
+		{
+			if (Helper.IsValidIndex(Index))
+			{
+				Codec.Write(Writer, SetProperty->ElementProp, Helper.GetElementPtr(Index));
+			}
+		}
+		Writer.WriteArrayEnd();
+	}
+
+	static bool ReadSet(const FMCPPropertyCodec& Codec, const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError)
+	{
+		if (Json.Type != EJson::Array)
+		{
+			return TypeError(Property, Json, OutError);
+		}
+		const FSetProperty* SetProperty = CastFieldChecked<FSetProperty>(Property);
+		const TArray<TSharedPtr<FJsonValue>>& Elements = Json.AsArray();
+
+		FScriptSetHelper Helper(SetProperty, Value);
+		Helper.EmptyElements(Elements.Num());
+		for (int32 Index = 0; Index < Elements.Num(); ++Index)
+		{
+			FScopedValue Element(SetProperty->ElementProp);
+			if (!Codec.Read(SetProperty->ElementProp, Element.Data, Elements[Index], Owner, OutError))
+			{
+				OutError = FString::Printf(TEXT("[%d]: %s"), Index, *OutError);
+				return false;
+			}
+			Helper.AddElement(Element.Data);
+		}
+		return true;
+	}
+
+	static void WriteMap(const FMCPPropertyCodec& Codec, FWriter& Writer, const FProperty* Property, const void* Value)
+	{
+		const FMapProperty* MapProperty = CastFieldChecked<FMapProperty>(Property);
+		FScriptMapHelper Helper(MapProperty, Value);
+		const bool bStringKey = HasStringKey(MapProperty->KeyProp);
+
+		if (bStringKey)
+		{
+			Writer.WriteObjectStart();
+		}
+		else
+		{
+			Writer.WriteArrayStart();
+		}
+		for (int32 Index = 0; Index < Helper.GetMaxIndex(); ++Index)
+		{
+			if (!Helper.IsValidIndex(Index))
+			{
+				continue;
+			}
+			if (bStringKey)
+			{
+				Writer.WriteIdentifierPrefix(KeyToString(MapProperty->KeyProp, Helper.GetKeyPtr(Index)));
+				Codec.Write(Writer, MapProperty->ValueProp, Helper.GetValuePtr(Index));
+			}
+			else
+			{
+				Writer.WriteObjectStart();
+				Writer.WriteIdentifierPrefix(TEXT("key"));
+				Codec.Write(Writer, MapProperty->KeyProp, Helper.GetKeyPtr(Index));
+				Writer.WriteIdentifierPrefix(TEXT("value"));
+				Codec.Write(Writer, MapProperty->ValueProp, Helper.GetValuePtr(Index));
+				Writer.WriteObjectEnd();
+			}
+		}
+		if (bStringKey)
+		{
+			Writer.WriteObjectEnd();
+		}
+		else
+		{
+			Writer.WriteArrayEnd();
+		}
+	}
+
+	static bool ReadMapPair(const FMCPPropertyCodec& Codec, const FMapProperty* MapProperty, FScriptMapHelper& Helper,
+		const FJsonValue& KeyJson, const TSharedPtr<FJsonValue>& ValueJson, UObject* Owner, FString& OutError)
+	{
+		FScopedValue Key(MapProperty->KeyProp);
+		FScopedValue Value(MapProperty->ValueProp);
+		if (!Codec.Read(MapProperty->KeyProp, Key.Data, KeyJson, Owner, OutError))
+		{
+			OutError = FString::Printf(TEXT("key: %s"), *OutError);
+			return false;
+		}
+		if (!Codec.Read(MapProperty->ValueProp, Value.Data, ValueJson, Owner, OutError))
+		{
+			OutError = FString::Printf(TEXT("[%s]: %s"), *KeyToString(MapProperty->KeyProp, Key.Data), *OutError);
+			return false;
+		}
+		Helper.AddPair(Key.Data, Value.Data);
+		return true;
+	}
+
+	static bool ReadMap(const FMCPPropertyCodec& Codec, const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError)
+	{
+		const FMapProperty* MapProperty = CastFieldChecked<FMapProperty>(Property);
+		FScriptMapHelper Helper(MapProperty, Value);
+
+		if (Json.Type == EJson::Object && HasStringKey(MapProperty->KeyProp))
+		{
+			const TSharedPtr<FJsonObject>& Object = Json.AsObject();
+			Helper.EmptyValues(Object->Values.Num());
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Object->Values)
+			{
+				if (!ReadMapPair(Codec, MapProperty, Helper, FJsonValueString(Pair.Key), Pair.Value, Owner, OutError))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		if (Json.Type == EJson::Array)
+		{
+			const TArray<TSharedPtr<FJsonValue>>& Pairs = Json.AsArray();
+			Helper.EmptyValues(Pairs.Num());
+			for (const TSharedPtr<FJsonValue>& PairJson : Pairs)
+			{
+				const TSharedPtr<FJsonObject>* Pair = nullptr;
+				if (!PairJson.IsValid() || !PairJson->TryGetObject(Pair) || !(*Pair)->HasField(TEXT("key")))
+				{
+					OutError = TEXT("Map entries must be {\"key\": ..., \"value\": ...}");
+					return false;
+				}
+				if (!ReadMapPair(Codec, MapProperty, Helper, *(*Pair)->TryGetField(TEXT("key")), (*Pair)->TryGetField(TEXT("value")), Owner, OutError))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		return TypeError(Property, Json, OutError);
+	}
+
+	// ---- structs ----
+
+	static void WriteStruct(const FMCPPropertyCodec& Codec, FWriter& Writer, const FProperty* Property, const void* Value)
+	{
+		Writer.WriteObjectStart();
+		Codec.WriteMembers(Writer, CastFieldChecked<FStructProperty>(Property)->Struct, Value);
+		Writer.WriteObjectEnd();
+	}
+
+	static bool ReadStruct(const FMCPPropertyCodec& Codec, const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError)
+	{
+		if (Json.Type == EJson::Object)
+		{
+			return Codec.ReadMembers(CastFieldChecked<FStructProperty>(Property)->Struct, Value, *Json.AsObject(), Owner, OutError);
+		}
+		if (Json.Type == EJson::String)
+		{
+			// "(X=1,Y=2,Z=3)" and other exported struct text
+			return ImportText(Property, Value, Json.AsString(), Owner, OutError);
+		}
+		return TypeError(Property, Json, OutError);
+	}
+
+	template<typename T, int32 Count>
+	static bool ReadFixedStruct(const FMCPPropertyCodec& Codec, const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner,
+		FString& OutError, TFunctionRef<T(const double*)> Make)
+	{
+		if (Json.Type != EJson::Array)
+		{
+			return ReadStruct(Codec, Property, Value, Json, Owner, OutError);
+		}
+		double Numbers[Count];
+		if (!ReadNumbers(Property, Json, Numbers, Count, OutError))
+		{
+			return false;
+		}
+		*static_cast<T*>(Value) = Make(Numbers);
+		return true;
+	}
+
+	static void WriteVector(const FMCPPropertyCodec&, FWriter& Writer, const FProperty*, const void* Value)
+	{
+		const FVector& Vector = *static_cast<const FVector*>(Value);
+		WriteNumbers(Writer, { Vector.X, Vector.Y, Vector.Z });
+	}
+
+	static bool ReadVector(const FMCPPropertyCodec& Codec, const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError)
+	{
+		if (Json.Type == EJson::Number)
+		{
+			// a single number sets all components
+			*static_cast<FVector*>(Value) = FVector(Json.AsNumber());
+			return true;
+		}
+		return ReadFixedStruct<FVector, 3>(Codec, Property, Value, Json, Owner, OutError,
+			[](const double* N) { return FVector(N[0], N[1], N[2]); });
+	}
+
+	static void WriteVector2D(const FMCPPropertyCodec&, FWriter& Writer, const FProperty*, const void* Value)
+	{
+		const FVector2D& Vector = *static_cast<const FVector2D*>(Value);
+		WriteNumbers(Writer, { Vector.X, Vector.Y });
+	}
+
+	static bool ReadVector2D(const FMCPPropertyCodec& Codec, const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError)
+	{
+		return ReadFixedStruct<FVector2D, 2>(Codec, Property, Value, Json, Owner, OutError,
+			[](const double* N) { return FVector2D(N[0], N[1]); });
+	}
+
+	static void WriteRotator(const FMCPPropertyCodec&, FWriter& Writer, const FProperty*, const void* Value)
+	{
+		const FRotator& Rotator = *static_cast<const FRotator*>(Value);
+		WriteNumbers(Writer, { Rotator.Pitch, Rotator.Yaw, Rotator.Roll });
+	}
+
+	static bool ReadRotator(const FMCPPropertyCodec& Codec, const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError)
+	{
+		return ReadFixedStruct<FRotator, 3>(Codec, Property, Value, Json, Owner, OutError,
+			[](const double* N) { return FRotator(N[0], N[1], N[2]); });
+	}
+
+	static void WriteQuat(const FMCPPropertyCodec&, FWriter& Writer, const FProperty*, const void* Value)
+	{
+		const FQuat& Quat = *static_cast<const FQuat*>(Value);
+		WriteNumbers(Writer, { Quat.X, Quat.Y, Quat.Z, Quat.W });
+	}
+
+	static bool ReadQuat(const FMCPPropertyCodec& Codec, const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError)
+	{
+		return ReadFixedStruct<FQuat, 4>(Codec, Property, Value, Json, Owner, OutError,
+			[](const double* N) { return FQuat(N[0], N[1], N[2], N[3]); });
+	}
+
+	static void WriteLinearColor(const FMCPPropertyCodec&, FWriter& Writer, const FProperty*, const void* Value)
+	{
+		const FLinearColor& Color = *static_cast<const FLinearColor*>(Value);
+		WriteNumbers(Writer, { Color.R, Color.G, Color.B, Color.A });
+	}
+
+	static bool ReadLinearColor(const FMCPPropertyCodec& Codec, const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError)
+	{
+		return ReadFixedStruct<FLinearColor, 4>(Codec, Property, Value, Json, Owner, OutError,
+			[](const double* N) { return FLinearColor(N[0], N[1], N[2], N[3]); });
+	}
+
+	static void WriteColor(const FMCPPropertyCodec&, FWriter& Writer, const FProperty*, const void* Value)
+	{
+		const FColor& Color = *static_cast<const FColor*>(Value);
+		WriteNumbers(Writer, { double(Color.R), double(Color.G), double(Color.B), double(Color.A) });
+	}
+
+	static bool ReadColor(const FMCPPropertyCodec& Codec, const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError)
+	{
+		return ReadFixedStruct<FColor, 4>(Codec, Property, Value, Json, Owner, OutError,
+			[](const double* N) { return FColor(uint8(N[0]), uint8(N[1]), uint8(N[2]), uint8(N[3])); });
+	}
+
+	static void WriteTransform(const FMCPPropertyCodec&, FWriter& Writer, const FProperty*, const void* Value)
+	{
+		const FTransform& Transform = *static_cast<const FTransform*>(Value);
+		Writer.WriteObjectStart();
+		FMCPJsonWriter::WriteVector(Writer, TEXT("location"), Transform.GetLocation());
+		FMCPJsonWriter::WriteRotator(Writer, TEXT("rotation"), Transform.Rotator());
+		FMCPJsonWriter::WriteVector(Writer, TEXT("scale"), Transform.GetScale3D());
+		Writer.WriteObjectEnd();
+	}
+
+	static bool ReadTransform(const FMCPPropertyCodec&, const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError)
+	{
+		if (Json.Type == EJson::String)
+		{
+			return ImportText(Property, Value, Json.AsString(), Owner, OutError);
+		}
+		if (Json.Type != EJson::Object)
+		{
+			return TypeError(Property, Json, OutError);
+		}
+
+		FTransform& Transform = *static_cast<FTransform*>(Value);
+		const FJsonObject& Object = *Json.AsObject();
+		double Numbers[4];
+		if (const TSharedPtr<FJsonValue> Location = Object.TryGetField(TEXT("location")))
+		{
+			if (!ReadNumbers(Property, *Location, Numbers, 3, OutError))
+			{
+				return false;
+			}
+			Transform.SetLocation(FVector(Numbers[0], Numbers[1], Numbers[2]));
+		}
+		if (const TSharedPtr<FJsonValue> Rotation = Object.TryGetField(TEXT("rotation")))
+		{
+			// [pitch, yaw, roll] or a quaternion [x, y, z, w]
+			const int32 Count = Rotation->Type == EJson::Array && Rotation->AsArray().Num() == 4 ? 4 : 3;
+			if (!ReadNumbers(Property, *Rotation, Numbers, Count, OutError))
+			{
+				return false;
+			}
+			Transform.SetRotation(Count == 4 ? FQuat(Numbers[0], Numbers[1], Numbers[2], Numbers[3]) : FQuat(FRotator(Numbers[0], Numbers[1], Numbers[2])));
+		}
+		if (const TSharedPtr<FJsonValue> Scale = Object.TryGetField(TEXT("scale")))
+		{
+			if (!ReadNumbers(Property, *Scale, Numbers, 3, OutError))
+			{
+				return false;
+			}
+			Transform.SetScale3D(FVector(Numbers[0], Numbers[1], Numbers[2]));
+		}
+		return true;
+	}
+
+	// ---- text fallback ----
+
+	static void WriteExportedText(FWriter& Writer, const FProperty* Property, const void* Value)
+	{
+		FString Text;
+		Property->ExportText_Direct(Text, Value, nullptr, nullptr, PPF_None);
+		Writer.WriteValue(Text);
+	}
+}
+
+const FMCPPropertyCodec& FMCPPropertyCodec::Get()
+{
+	static const FMCPPropertyCodec Codec;
+	return Codec;
+}
+
+FMCPPropertyCodec::FMCPPropertyCodec()
+{
+	using namespace MCPPropertyCodec;
+
+	ByFieldClass.Add(FBoolProperty::StaticClass(), { &WriteBool, &ReadBool });
+	// every integer and floating point width, and TEnumAsByte
+	ByFieldClass.Add(FNumericProperty::StaticClass(), { &WriteNumeric, &ReadNumeric });
+	ByFieldClass.Add(FEnumProperty::StaticClass(), { &WriteEnumProperty, &ReadEnumProperty });
+	ByFieldClass.Add(FStrProperty::StaticClass(), { &WriteStr, &ReadStr });
+	ByFieldClass.Add(FNameProperty::StaticClass(), { &WriteName, &ReadName });
+	ByFieldClass.Add(FTextProperty::StaticClass(), { &WriteText, &ReadText });
+	// hard, weak and lazy object and class references
+	ByFieldClass.Add(FObjectPropertyBase::StaticClass(), { &WriteObject, &ReadObject });
+	// soft object and soft class references derive from FObjectPropertyBase but hold a path
+	ByFieldClass.Add(FSoftObjectProperty::StaticClass(), { &WriteSoftObject, &ReadSoftObject });
+	ByFieldClass.Add(FArrayProperty::StaticClass(), { &WriteArray, &ReadArray });
+	ByFieldClass.Add(FSetProperty::StaticClass(), { &WriteSet, &ReadSet });
+	ByFieldClass.Add(FMapProperty::StaticClass(), { &WriteMap, &ReadMap });
+	ByFieldClass.Add(FStructProperty::StaticClass(), { &WriteStruct, &ReadStruct });
+
+	ByStruct.Add(TBaseStructure<FVector>::Get(), { &WriteVector, &ReadVector });
+	ByStruct.Add(TBaseStructure<FVector2D>::Get(), { &WriteVector2D, &ReadVector2D });
+	ByStruct.Add(TBaseStructure<FRotator>::Get(), { &WriteRotator, &ReadRotator });
+	ByStruct.Add(TBaseStructure<FQuat>::Get(), { &WriteQuat, &ReadQuat });
+	ByStruct.Add(TBaseStructure<FLinearColor>::Get(), { &WriteLinearColor, &ReadLinearColor });
+	ByStruct.Add(TBaseStructure<FColor>::Get(), { &WriteColor, &ReadColor });
+	ByStruct.Add(TBaseStructure<FTransform>::Get(), { &WriteTransform, &ReadTransform });
+}
+
+const FMCPPropertyCodec::FEntry* FMCPPropertyCodec::FindEntry(const FProperty* Property) const
+{
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		if (const FEntry* Entry = ByStruct.Find(StructProperty->Struct))
+		{
+			return Entry;
+		}
+	}
+	for (const FFieldClass* FieldClass = Property->GetClass(); FieldClass; FieldClass = FieldClass->GetSuperClass())
+	{
+		if (const FEntry* Entry = ByFieldClass.Find(FieldClass))
+		{
+			return Entry;
+		}
+	}
+	return nullptr;
+}
+
+void FMCPPropertyCodec::Write(FWriter& Writer, const FProperty* Property, const void* Value) const
+{
+	if (const FEntry* Entry = FindEntry(Property))
+	{
+		Entry->Write(*this, Writer, Property, Value);
+	}
+	else
+	{
+		MCPPropertyCodec::WriteExportedText(Writer, Property, Value);
+	}
+}
+
+void FMCPPropertyCodec::WriteMembers(FWriter& Writer, const UStruct* Struct, const void* Container, EPropertyFlags SkipFlags) const
+{
+	for (TFieldIterator<FProperty> It(Struct); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (Property->HasAnyPropertyFlags(SkipFlags))
+		{
+			continue;
+		}
+
+		Writer.WriteIdentifierPrefix(Property->GetName());
+		if (Property->ArrayDim == 1)
+		{
+			Write(Writer, Property, Property->ContainerPtrToValuePtr<void>(Container));
+		}
+		else
+		{
+			Writer.WriteArrayStart();
+			for (int32 Index = 0; Index < Property->ArrayDim; ++Index)
+			{
+				Write(Writer, Property, Property->ContainerPtrToValuePtr<void>(Container, Index));
+			}
+			Writer.WriteArrayEnd();
+		}
+	}
+}
+
+bool FMCPPropertyCodec::Read(const FProperty* Property, void* Value, const TSharedPtr<FJsonValue>& Json, UObject* Owner, FString& OutError) const
+{
+	if (!Json.IsValid())
+	{
+		OutError = FString::Printf(TEXT("Missing value for %s"), *Property->GetName());
+		return false;
+	}
+	return Read(Property, Value, *Json, Owner, OutError);
+}
+
+bool FMCPPropertyCodec::Read(const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError) const
+{
+	if (const FEntry* Entry = FindEntry(Property))
+	{
+		return Entry->Read(*this, Property, Value, Json, Owner, OutError);
+	}
+	if (Json.Type == EJson::String)
+	{
+		return MCPPropertyCodec::ImportText(Property, Value, Json.AsString(), Owner, OutError);
+	}
+	OutError = FString::Printf(TEXT("Unsupported property type: %s for property %s"), *Property->GetClass()->GetName(), *Property->GetName());
+	return false;
+}
+
+bool FMCPPropertyCodec::ReadMembers(const UStruct* Struct, void* Container, const FJsonObject& Object, UObject* Owner, FString& OutError) const
+{
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Object.Values)
+	{
+		const FProperty* Property = FindFProperty<FProperty>(Struct, *Pair.Key);
+		if (!Property)
+		{
+			OutError = FString::Printf(TEXT("Property not found: %s (on %s)"), *Pair.Key, *Struct->GetName());
+			return false;
+		}
+
+		bool bOk = true;
+		if (Property->ArrayDim == 1)
+		{
+			bOk = Read(Property, Property->ContainerPtrToValuePtr<void>(Container), Pair.Value, Owner, OutError);
+		}
+		else
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Elements = nullptr;
+			if (!Pair.Value.IsValid() || !Pair.Value->TryGetArray(Elements) || Elements->Num() > Property->ArrayDim)
+			{
+				OutError = FString::Printf(TEXT("an array of at most %d values"), Property->ArrayDim);
+				bOk = false;
+			}
+			for (int32 Index = 0; bOk && Index < Elements->Num(); ++Index)
+			{
+				bOk = Read(Property, Property->ContainerPtrToValuePtr<void>(Container, Index), (*Elements)[Index], Owner, OutError);
+			}
+		}
+		if (!bOk)
+		{
+			OutError = FString::Printf(TEXT("%s: %s"), *Pair.Key, *OutError);
+			return false;
+		}
+	}
+	return true;
+}
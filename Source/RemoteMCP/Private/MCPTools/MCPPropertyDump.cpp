@@ -0,0 +1,282 @@
+#include "MCPTools/MCPPropertyDump.h"
+
+#include "Dom/JsonObject.h"
+#include "MCPTools/MCPPropertyCodec.h"
+#include "UObject/UnrealType.h"
+
+namespace MCPPropertyDump
+{
+	// enough to show what was dropped without the list becoming the payload
+	static constexpr int32 MaxOmittedPaths = 50;
+
+	/** A list given either as a json array or as a comma separated string. */
+	static void ReadPathList(const FJsonObject& Params, const TCHAR* Field, TArray<FString>& Out)
+	{
+		Out.Reset();
+		TArray<FString> Parts;
+		const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+		FString List;
+		if (Params.TryGetArrayField(Field, Array))
+		{
+			for (const TSharedPtr<FJsonValue>& Value : *Array)
+			{
+				FString Path;
+				if (Value.IsValid() && Value->TryGetString(Path))
+				{
+					Parts.Add(MoveTemp(Path));
+				}
+			}
+		}
+		else if (Params.TryGetStringField(Field, List))
+		{
+			List.ParseIntoArray(Parts, TEXT(","), true);
+		}
+
+		for (FString& Part : Parts)
+		{
+			Part.TrimStartAndEndInline();
+			if (!Part.IsEmpty())
+			{
+				Out.AddUnique(MoveTemp(Part));
+			}
+		}
+	}
+
+	/** Path is Ancestor itself or lies below it ("A.B" and "A[2]" are below "A"). */
+	static bool IsAtOrBelow(const FString& Path, const FString& Ancestor)
+	{
+		if (!Path.StartsWith(Ancestor))
+		{
+			return false;
+		}
+		if (Path.Len() == Ancestor.Len())
+		{
+			return true;
+		}
+		const TCHAR Next = Path[Ancestor.Len()];
+		return Next == TEXT('.') || Next == TEXT('[');
+	}
+}
+
+void FMCPPropertyDump::FOptions::Parse(const FJsonObject& Params)
+{
+	double Number = 0.0;
+	if (Params.TryGetNumberField(TEXT("max_depth"), Number))
+	{
+		MaxDepth = FMath::Clamp(static_cast<int32>(Number), 0, 32);
+	}
+	if (Params.TryGetNumberField(TEXT("max_bytes"), Number) && Number > 0.0)
+	{
+		MaxChars = static_cast<int32>(FMath::Min(Number, static_cast<double>(MAX_int32)));
+	}
+	Params.TryGetBoolField(TEXT("non_default_only"), bNonDefaultOnly);
+	MCPPropertyDump::ReadPathList(Params, TEXT("paths"), Paths);
+	MCPPropertyDump::ReadPathList(Params, TEXT("exclude"), Exclude);
+}
+
+FMCPPropertyDump::FMCPPropertyDump(FMCPJsonWriter& InWriter, const FOptions& InOptions)
+	: Writer(InWriter)
+	, Options(InOptions)
+{
+}
+
+void FMCPPropertyDump::WriteObject(const UObject* Object, const FString& Prefix)
+{
+	Root = Object;
+	RootArchetype = Options.bNonDefaultOnly ? Object->GetArchetype() : nullptr;
+	if (RootArchetype && !Object->IsA(RootArchetype->GetClass()))
+	{
+		RootArchetype = nullptr;
+	}
+	WriteMembers(Object->GetClass(), Object, RootArchetype, Prefix, 0);
+}
+
+bool FMCPPropertyDump::IsWanted(const FString& Prefix) const
+{
+	return Match(Prefix) != EMatch::Skip;
+}
+
+void FMCPPropertyDump::WriteSummary() const
+{
+	Writer->WriteValue(TEXT("truncated"), bTruncated);
+	if (OmittedCount > 0)
+	{
+		Writer->WriteArrayStart(TEXT("omitted"));
+		for (const FString& Path : Omitted)
+		{
+			Writer->WriteValue(Path);
+		}
+		Writer->WriteArrayEnd();
+		Writer->WriteValue(TEXT("omitted_count"), OmittedCount);
+	}
+}
+
+FMCPPropertyDump::EMatch FMCPPropertyDump::Match(const FString& Path) const
+{
+	for (const FString& Excluded : Options.Exclude)
+	{
+		if (MCPPropertyDump::IsAtOrBelow(Path, Excluded))
+		{
+			return EMatch::Skip;
+		}
+	}
+	if (Options.Paths.IsEmpty())
+	{
+		return EMatch::All;
+	}
+
+	EMatch Result = EMatch::Skip;
+	for (const FString& Selected : Options.Paths)
+	{
+		if (MCPPropertyDump::IsAtOrBelow(Path, Selected))
+		{
+			return EMatch::All;
+		}
+		if (Path.IsEmpty() || MCPPropertyDump::IsAtOrBelow(Selected, Path))
+		{
+			Result = EMatch::Partial;
+		}
+	}
+	return Result;
+}
+
+bool FMCPPropertyDump::IsDefault(const FProperty* Property, const void* Value, const void* Default) const
+{
+	if (!Default)
+	{
+		return false;
+	}
+	if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+	{
+		// instanced subobjects (components) never share a pointer with their template; their own edits are dumped on
+		// their own, so a reference to the counterpart of the archetype's subobject counts as unchanged
+		const UObject* Current = ObjectProperty->GetObjectPropertyValue(Value);
+		const UObject* Template = ObjectProperty->GetObjectPropertyValue(Default);
+		if (Current && Template && Current != Template && Current->IsIn(Root) && RootArchetype && Template->IsIn(RootArchetype))
+		{
+			return Current->GetFName() == Template->GetFName() && Current->GetClass() == Template->GetClass();
+		}
+	}
+	return Property->Identical(Value, Default, PPF_None);
+}
+
+bool FMCPPropertyDump::NeedsDepth(const FProperty* Property) const
+{
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		return !FMCPPropertyCodec::Get().HasStructFastPath(StructProperty->Struct);
+	}
+	return Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>() || Property->IsA<FMapProperty>();
+}
+
+bool FMCPPropertyDump::HasBudget()
+{
+	if (Writer.GetLength() < Options.MaxChars)
+	{
+		return true;
+	}
+	bTruncated = true;
+	return false;
+}
+
+void FMCPPropertyDump::Omit(const FString& Path)
+{
+	if (Omitted.Num() < MCPPropertyDump::MaxOmittedPaths)
+	{
+		Omitted.Add(Path);
+	}
+	++OmittedCount;
+}
+
+void FMCPPropertyDump::WriteMembers(const UStruct* Struct, const void* Container, const void* Defaults, const FString& Prefix, int32 Depth)
+{
+	for (TFieldIterator<FProperty> It(Struct); It; ++It)
+	{
+		const FProperty* Property = *It;
+		if (Property->HasAnyPropertyFlags(CPF_Deprecated | CPF_Transient))
+		{
+			continue;
+		}
+
+		const FString Name = Property->GetName();
+		const FString Path = Prefix.IsEmpty() ? Name : Prefix + TEXT(".") + Name;
+		if (Match(Path) == EMatch::Skip)
+		{
+			continue;
+		}
+
+		bool bDefault = Options.bNonDefaultOnly && Defaults;
+		for (int32 Index = 0; bDefault && Index < Property->ArrayDim; ++Index)
+		{
+			bDefault = IsDefault(Property, Property->ContainerPtrToValuePtr<void>(Container, Index), Property->ContainerPtrToValuePtr<void>(Defaults, Index));
+		}
+		if (bDefault)
+		{
+			continue;
+		}
+
+		if (!HasBudget() || (Depth >= Options.MaxDepth && (Property->ArrayDim > 1 || NeedsDepth(Property))))
+		{
+			Omit(Path);
+			continue;
+		}
+
+		Writer->WriteIdentifierPrefix(Name);
+		if (Property->ArrayDim == 1)
+		{
+			WriteValue(Property, Property->ContainerPtrToValuePtr<void>(Container), Defaults ? Property->ContainerPtrToValuePtr<void>(Defaults) : nullptr, Path, Depth);
+		}
+		else
+		{
+			Writer->WriteArrayStart();
+			for (int32 Index = 0; Index < Property->ArrayDim; ++Index)
+			{
+				WriteValue(Property, Property->ContainerPtrToValuePtr<void>(Container, Index),
+					Defaults ? Property->ContainerPtrToValuePtr<void>(Defaults, Index) : nullptr, FString::Printf(TEXT("%s[%d]"), *Path, Index), Depth + 1);
+			}
+			Writer->WriteArrayEnd();
+		}
+	}
+}
+
+void FMCPPropertyDump::WriteValue(const FProperty* Property, const void* Value, const void* Default, const FString& Path, int32 Depth)
+{
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		if (!FMCPPropertyCodec::Get().HasStructFastPath(StructProperty->Struct))
+		{
+			// members are compared against the default struct one by one, so only the edited ones are written
+			Writer->WriteObjectStart();
+			WriteMembers(StructProperty->Struct, Value, Default, Path, Depth + 1);
+			Writer->WriteObjectEnd();
+			return;
+		}
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		// elements have no defaults of their own; the array is written whole, within the budget
+		FScriptArrayHelper Helper(ArrayProperty, Value);
+		const bool bElementsNeedDepth = NeedsDepth(ArrayProperty->Inner);
+		Writer->WriteArrayStart();
+		for (int32 Index = 0; Index < Helper.Num(); ++Index)
+		{
+			const FString ElementPath = FString::Printf(TEXT("%s[%d]"), *Path, Index);
+			if (!HasBudget() || (bElementsNeedDepth && Depth + 1 >= Options.MaxDepth))
+			{
+				Omit(ElementPath);
+				// keep the indices of the written elements meaningful: stop at the first omission
+				break;
+			}
+			if (Match(ElementPath) == EMatch::Skip)
+			{
+				Writer->WriteNull();
+				continue;
+			}
+			WriteValue(ArrayProperty->Inner, Helper.GetRawPtr(Index), nullptr, ElementPath, Depth + 1);
+		}
+		Writer->WriteArrayEnd();
+		return;
+	}
+
+	FMCPPropertyCodec::Get().Write(Writer.Get(), Property, Value);
+}
@@ -0,0 +1,372 @@
+#include "MCPTools/MCPPropertyPath.h"
+
+#include "Editor.h"
+#include "Dom/JsonValue.h"
+#include "Misc/ScopeExit.h"
+#include "MCPTools/MCPPropertyCodec.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UnrealType.h"
+
+namespace MCPPropertyPath
+{
+	// paths come from a small vocabulary of tool calls; this only guards against unbounded growth
+	static constexpr int32 MaxPaths = 4096;
+
+	struct FSegment
+	{
+		FString Name;
+		FString Index;
+		bool bIndexed = false;
+	};
+
+	/** Split "A.B[2].C" / "Map[Some.Key].Value" into segments; dots inside brackets belong to the key. */
+	static bool Split(const FString& Path, TArray<FSegment>& Out, FString& OutError)
+	{
+		FSegment Current;
+		int32 Pos = 0;
+		while (Pos < Path.Len())
+		{
+			const TCHAR Char = Path[Pos];
+			if (Char == TEXT('.'))
+			{
+				if (Current.Name.IsEmpty())
+				{
+					OutError = FString::Printf(TEXT("Empty segment in property path '%s'"), *Path);
+					return false;
+				}
+				Out.Add(MoveTemp(Current));
+				Current = FSegment();
+				++Pos;
+			}
+			else if (Char == TEXT('['))
+			{
+				const int32 Close = Path.Find(TEXT("]"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Pos);
+				if (Close == INDEX_NONE || Current.Name.IsEmpty() || Current.bIndexed)
+				{
+					OutError = FString::Printf(TEXT("Malformed index in property path '%s'"), *Path);
+					return false;
+				}
+				Current.Index = Path.Mid(Pos + 1, Close - Pos - 1).TrimStartAndEnd().TrimQuotes();
+				Current.bIndexed = true;
+				Pos = Close + 1;
+			}
+			else
+			{
+				if (Current.bIndexed)
+				{
+					OutError = FString::Printf(TEXT("Expected '.' after ']' in property path '%s'"), *Path);
+					return false;
+				}
+				Current.Name.AppendChar(Char);
+				++Pos;
+			}
+		}
+		if (Current.Name.IsEmpty())
+		{
+			OutError = FString::Printf(TEXT("Empty segment in property path '%s'"), *Path);
+			return false;
+		}
+		Out.Add(MoveTemp(Current));
+		return true;
+	}
+
+	static bool ParseIndex(const FSegment& Segment, int32& OutIndex, FString& OutError)
+	{
+		if (!Segment.Index.IsNumeric() || Segment.Index.Contains(TEXT(".")))
+		{
+			OutError = FString::Printf(TEXT("Index of '%s' must be an integer, got '%s'"), *Segment.Name, *Segment.Index);
+			return false;
+		}
+		OutIndex = FCString::Atoi(*Segment.Index);
+		if (OutIndex < 0)
+		{
+			OutError = FString::Printf(TEXT("Index of '%s' must not be negative"), *Segment.Name);
+			return false;
+		}
+		return true;
+	}
+}
+
+bool FMCPPropertyPath::Compile(const UStruct* Struct, const FString& Path, FMCPPropertyPath& Out, FString& OutError)
+{
+	TArray<MCPPropertyPath::FSegment> Segments;
+	if (!MCPPropertyPath::Split(Path, Segments, OutError))
+	{
+		return false;
+	}
+
+	Out.Path = Path;
+	Out.Steps.Reset(Segments.Num());
+
+	const UStruct* Current = Struct;
+	for (int32 SegmentIndex = 0; SegmentIndex < Segments.Num(); ++SegmentIndex)
+	{
+		const MCPPropertyPath::FSegment& Segment = Segments[SegmentIndex];
+		if (!Current)
+		{
+			OutError = FString::Printf(TEXT("Cannot resolve '%s' in '%s': '%s' has no members"),
+				*Segment.Name, *Path, *Segments[SegmentIndex - 1].Name);
+			return false;
+		}
+
+		FProperty* Property = FindFProperty<FProperty>(Current, *Segment.Name);
+		if (!Property)
+		{
+			OutError = FString::Printf(TEXT("Property not found: %s (on %s)"), *Segment.Name, *Current->GetName());
+			return false;
+		}
+
+		FStep& Step = Out.Steps.AddDefaulted_GetRef();
+		Step.Property = Property;
+		Step.ValueProperty = Property;
+
+		if (Segment.bIndexed)
+		{
+			if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				if (!MCPPropertyPath::ParseIndex(Segment, Step.Index, OutError))
+				{
+					return false;
+				}
+				Step.Access = EAccess::Array;
+				Step.ValueProperty = ArrayProperty->Inner;
+			}
+			else if (FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+			{
+				Step.Access = EAccess::Map;
+				Step.Key = Segment.Index;
+				Step.ValueProperty = MapProperty->ValueProp;
+			}
+			else if (Property->ArrayDim > 1)
+			{
+				if (!MCPPropertyPath::ParseIndex(Segment, Step.Index, OutError))
+				{
+					return false;
+				}
+				if (Step.Index >= Property->ArrayDim)
+				{
+					OutError = FString::Printf(TEXT("Index %d out of range for '%s' (size %d)"), Step.Index, *Segment.Name, Property->ArrayDim);
+					return false;
+				}
+				Step.Access = EAccess::StaticArray;
+			}
+			else
+			{
+				OutError = FString::Printf(TEXT("Property '%s' is not an array or map"), *Segment.Name);
+				return false;
+			}
+		}
+
+		const bool bLast = SegmentIndex == Segments.Num() - 1;
+		if (FStructProperty* StructProperty = CastField<FStructProperty>(Step.ValueProperty))
+		{
+			Current = StructProperty->Struct;
+		}
+		else if (FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Step.ValueProperty))
+		{
+			Current = ObjectProperty->PropertyClass;
+			Step.bDereference = !bLast;
+		}
+		else
+		{
+			Current = nullptr;
+		}
+	}
+	return true;
+}
+
+void FMCPPropertyPath::FAddedKey::Remove()
+{
+	if (Map)
+	{
+		FScriptMapHelper Helper(Map, MapAddress);
+		Helper.RemoveAt(Index);
+		Helper.Rehash();
+		Map = nullptr;
+	}
+}
+
+void* FMCPPropertyPath::Resolve(UObject* Object, FString& OutError, bool bAddMissingKeys) const
+{
+	FAddedKey Added;
+	return Resolve(Object, OutError, bAddMissingKeys, Added);
+}
+
+void* FMCPPropertyPath::Resolve(UObject* Object, FString& OutError, bool bAddMissingKeys, FAddedKey& OutAdded) const
+{
+	if (!Object)
+	{
+		OutError = TEXT("Invalid object");
+		return nullptr;
+	}
+
+	void* Container = Object;
+	void* Value = nullptr;
+	// a step below a freshly added key failed: drop the entry instead of leaving a default behind
+	bool bResolved = false;
+	ON_SCOPE_EXIT
+	{
+		if (!bResolved)
+		{
+			OutAdded.Remove();
+		}
+	};
+	for (const FStep& Step : Steps)
+	{
+		switch (Step.Access)
+		{
+		case EAccess::Value:
+			Value = Step.Property->ContainerPtrToValuePtr<void>(Container);
+			break;
+
+		case EAccess::StaticArray:
+			Value = Step.Property->ContainerPtrToValuePtr<void>(Container, Step.Index);
+			break;
+
+		case EAccess::Array:
+			{
+				FScriptArrayHelper Helper(CastFieldChecked<FArrayProperty>(Step.Property), Step.Property->ContainerPtrToValuePtr<void>(Container));
+				if (!Helper.IsValidIndex(Step.Index))
+				{
+					OutError = FString::Printf(TEXT("Index %d out of range for '%s' (size %d)"), Step.Index, *Step.Property->GetName(), Helper.Num());
+					return nullptr;
+				}
+				Value = Helper.GetRawPtr(Step.Index);
+			}
+			break;
+
+		case EAccess::Map:
+			{
+				FMapProperty* MapProperty = CastFieldChecked<FMapProperty>(Step.Property);
+				void* MapAddress = MapProperty->ContainerPtrToValuePtr<void>(Container);
+				FScriptMapHelper Helper(MapProperty, MapAddress);
+
+				FProperty* KeyProperty = MapProperty->KeyProp;
+				void* Key = FMemory::Malloc(KeyProperty->GetSize(), KeyProperty->GetMinAlignment());
+				KeyProperty->InitializeValue(Key);
+				ON_SCOPE_EXIT
+				{
+					KeyProperty->DestroyValue(Key);
+					FMemory::Free(Key);
+				};
+
+				if (!KeyProperty->ImportText_Direct(*Step.Key, Key, nullptr, PPF_None))
+				{
+					OutError = FString::Printf(TEXT("Invalid key '%s' for map '%s'"), *Step.Key, *MapProperty->GetName());
+					return nullptr;
+				}
+
+				Value = Helper.FindValueFromHash(Key);
+				if (!Value && bAddMissingKeys)
+				{
+					const int32 NewIndex = Helper.AddDefaultValue_Invalid_NeedsRehash();
+					KeyProperty->CopySingleValue(Helper.GetKeyPtr(NewIndex), Key);
+					Helper.Rehash();
+					Value = Helper.GetValuePtr(NewIndex);
+					if (!OutAdded.Map)
+					{
+						OutAdded = FAddedKey{ MapProperty, MapAddress, NewIndex };
+					}
+				}
+				if (!Value)
+				{
+					OutError = FString::Printf(TEXT("Key '%s' not found in map '%s'"), *Step.Key, *MapProperty->GetName());
+					return nullptr;
+				}
+			}
+			break;
+		}
+
+		if (Step.bDereference)
+		{
+			UObject* Next = CastFieldChecked<FObjectPropertyBase>(Step.ValueProperty)->GetObjectPropertyValue(Value);
+			if (!Next)
+			{
+				OutError = FString::Printf(TEXT("'%s' is None in property path '%s'"), *Step.Property->GetName(), *Path);
+				return nullptr;
+			}
+			Container = Next;
+		}
+		else
+		{
+			Container = Value;
+		}
+	}
+	bResolved = true;
+	return Value;
+}
+
+bool FMCPPropertyPath::SetValue(UObject* Object, const TSharedPtr<FJsonValue>& Value, FString& OutError) const
+{
+	FAddedKey Added;
+	void* Address = Resolve(Object, OutError, true, Added);
+	if (!Address)
+	{
+		return false;
+	}
+	if (!FMCPPropertyCodec::Get().Read(GetLeafProperty(), Address, Value, Object, OutError))
+	{
+		Added.Remove();
+		return false;
+	}
+	return true;
+}
+
+FMCPPropertyPathCache& FMCPPropertyPathCache::Get()
+{
+	static FMCPPropertyPathCache Cache;
+	return Cache;
+}
+
+void FMCPPropertyPathCache::Initialize()
+{
+	ReinstancedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda([this](const TMap<UObject*, UObject*>&) { Reset(); });
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason) { Reset(); });
+	if (GEditor)
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FMCPPropertyPathCache::Reset);
+	}
+}
+
+void FMCPPropertyPathCache::Shutdown()
+{
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ReinstancedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+	Reset();
+}
+
+const FMCPPropertyPath* FMCPPropertyPathCache::Find(const UStruct* Struct, const FString& Path, FString& OutError)
+{
+	if (!Struct)
+	{
+		OutError = TEXT("Invalid object");
+		return nullptr;
+	}
+
+	const TPair<FObjectKey, FString> Key(FObjectKey(Struct), Path);
+	if (const TUniquePtr<FMCPPropertyPath>* Found = Paths.Find(Key))
+	{
+		return Found->Get();
+	}
+
+	TUniquePtr<FMCPPropertyPath> Compiled = MakeUnique<FMCPPropertyPath>();
+	if (!FMCPPropertyPath::Compile(Struct, Path, *Compiled, OutError))
+	{
+		return nullptr;
+	}
+
+	if (Paths.Num() >= MCPPropertyPath::MaxPaths)
+	{
+		Paths.Reset();
+	}
+	return Paths.Add(Key, MoveTemp(Compiled)).Get();
+}
+
+void FMCPPropertyPathCache::Reset()
+{
+	Paths.Reset();
+}
@@ -45,75 +45,86 @@ static FString VisibilityToString(EVisibility V)
 	return TEXT("SelfHitTestInvisible");
 }
 
+/** 对列表中的每个对象按 fields 做字段裁剪 */
+static void ProjectFields(TArray<TSharedPtr<FJsonValue>>& Items, const FMCPFieldMask& Fields)
+{
+	if (Fields.IsAll())
+	{
+		return;
+	}
+	for (const TSharedPtr<FJsonValue>& Item : Items)
+	{
+		const TSharedPtr<FJsonObject>* Object = nullptr;
+		if (Item.IsValid() && Item->TryGetObject(Object) && Object && Object->IsValid())
+		{
+			Fields.Project(**Object);
+		}
+	}
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // Private helpers
 // ─────────────────────────────────────────────────────────────────────────────
 
-TSharedPtr<FJsonObject> UMCPSlateTools::WidgetToJson(TSharedRef<SWidget> Widget, int32 MaxDepth, int32 CurrentDepth)
+void UMCPSlateTools::WriteWidgetJson(FMCPJsonWriter::FWriter& Writer, TSharedRef<SWidget> Widget, int32 MaxDepth, int32 CurrentDepth)
 {
-	TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
-	Obj->SetStringField(TEXT("type"),       Widget->GetType().ToString());
-	Obj->SetStringField(TEXT("tag"),        Widget->GetTag().ToString());
-	Obj->SetStringField(TEXT("visibility"), VisibilityToString(Widget->GetVisibility()));
+	Writer.WriteObjectStart();
+	Writer.WriteValue(TEXT("type"),       Widget->GetType().ToString());
+	Writer.WriteValue(TEXT("tag"),        Widget->GetTag().ToString());
+	Writer.WriteValue(TEXT("visibility"), VisibilityToString(Widget->GetVisibility()));
 
 	// 针对常用文本类控件提取文本内容
 	const FName WidgetType = Widget->GetType();
 	if (WidgetType == "STextBlock")
 	{
 		TSharedRef<STextBlock> TB = StaticCastSharedRef<STextBlock>(Widget);
-		Obj->SetStringField(TEXT("text"), TB->GetText().ToString());
+		Writer.WriteValue(TEXT("text"), TB->GetText().ToString());
 	}
 	else if (WidgetType == "SEditableText")
 	{
 		TSharedRef<SEditableText> ET = StaticCastSharedRef<SEditableText>(Widget);
-		Obj->SetStringField(TEXT("text"),      ET->GetText().ToString());
-		Obj->SetStringField(TEXT("hint_text"), ET->GetHintText().ToString());
+		Writer.WriteValue(TEXT("text"),      ET->GetText().ToString());
+		Writer.WriteValue(TEXT("hint_text"), ET->GetHintText().ToString());
 	}
 	else if (WidgetType == "SEditableTextBox")
 	{
 		TSharedRef<SEditableTextBox> ETB = StaticCastSharedRef<SEditableTextBox>(Widget);
-		Obj->SetStringField(TEXT("text"), ETB->GetText().ToString());
+		Writer.WriteValue(TEXT("text"), ETB->GetText().ToString());
 	}
 	else if (WidgetType == "SMultiLineEditableTextBox")
 	{
 		TSharedRef<SMultiLineEditableTextBox> MLETB = StaticCastSharedRef<SMultiLineEditableTextBox>(Widget);
-		Obj->SetStringField(TEXT("hint_text"), MLETB->GetHintText().ToString());
+		Writer.WriteValue(TEXT("hint_text"), MLETB->GetHintText().ToString());
 	}
 
 	// 递归子节点（受 MaxDepth 限制）
-	if (CurrentDepth < MaxDepth)
+	FChildren* Children = Widget->GetChildren();
+	if (Children && Children->Num() > 0)
 	{
-		FChildren* Children = Widget->GetChildren();
-		if (Children && Children->Num() > 0)
+		if (CurrentDepth < MaxDepth)
 		{
-			TArray<TSharedPtr<FJsonValue>> ChildArray;
+			Writer.WriteArrayStart(TEXT("children"));
 			const int32 ChildCount = FMath::Min(Children->Num(), 64); // 单层最多 64 个，防止爆炸
 			for (int32 i = 0; i < ChildCount; i++)
 			{
-				TSharedRef<SWidget> Child = Children->GetChildAt(i);
-				TSharedPtr<FJsonObject> ChildObj = WidgetToJson(Child, MaxDepth, CurrentDepth + 1);
-				ChildArray.Add(MakeShared<FJsonValueObject>(ChildObj));
+				WriteWidgetJson(Writer, Children->GetChildAt(i), MaxDepth, CurrentDepth + 1);
 			}
 			if (Children->Num() > 64)
 			{
-				TSharedPtr<FJsonObject> TruncObj = MakeShared<FJsonObject>();
-				TruncObj->SetStringField(TEXT("type"), FString::Printf(TEXT("... (%d more children truncated)"), Children->Num() - 64));
-				ChildArray.Add(MakeShared<FJsonValueObject>(TruncObj));
+				Writer.WriteObjectStart();
+				Writer.WriteValue(TEXT("type"), FString::Printf(TEXT("... (%d more children truncated)"), Children->Num() - 64));
+				Writer.WriteObjectEnd();
 			}
-			Obj->SetArrayField(TEXT("children"), ChildArray);
+			Writer.WriteArrayEnd();
 		}
-	}
-	else
-	{
-		// 达到深度限制时仅记录子节点数量
-		FChildren* Children = Widget->GetChildren();
-		if (Children && Children->Num() > 0)
+		else
 		{
-			Obj->SetNumberField(TEXT("children_count_truncated"), Children->Num());
+			// 达到深度限制时仅记录子节点数量
+			Writer.WriteValue(TEXT("children_count_truncated"), Children->Num());
 		}
 	}
 
-	return Obj;
+	Writer.WriteObjectEnd();
 }
 
 void UMCPSlateTools::FindWidgetsByTypeRecursive(
@@ -310,13 +321,13 @@ FJsonObjectParameter UMCPSlateTools::HandleGetWidgetTree(const FJsonObjectParame
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No matching window found"));
 	}
 
-	TSharedPtr<FJsonObject> Tree = WidgetToJson(TargetWindow.ToSharedRef(), MaxDepth, 0);
-
-	FJsonObjectParameter Result = MakeShared<FJsonObject>();
-	Result->SetStringField(TEXT("window_title"), TargetWindow->GetTitle().ToString());
-	Result->SetNumberField(TEXT("max_depth"),     MaxDepth);
-	Result->SetObjectField(TEXT("widget_tree"),   Tree);
-	return Result;
+	FMCPJsonWriter Writer;
+	Writer.BeginObject();
+	Writer->WriteValue(TEXT("window_title"), TargetWindow->GetTitle().ToString());
+	Writer->WriteValue(TEXT("max_depth"),    MaxDepth);
+	Writer->WriteIdentifierPrefix(TEXT("widget_tree"));
+	WriteWidgetJson(Writer.Get(), TargetWindow.ToSharedRef(), MaxDepth, 0);
+	return Writer.Finish();
 }
 
 FJsonObjectParameter UMCPSlateTools::HandleGetWidgetUnderCursor(const FJsonObjectParameter& Params)
@@ -444,6 +455,13 @@ FJsonObjectParameter UMCPSlateTools::HandleFindWidgetsByType(const FJsonObjectPa
 		}
 	}
 
+	FMCPPageRequest Page;
+	FString PageError;
+	if (!Page.Parse(Params, TEXT("widgets"), PageError))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(PageError);
+	}
+
 	TArray<TSharedPtr<FJsonValue>> FoundWidgets;
 	for (const TSharedPtr<SWindow>& Win : SearchWindows)
 	{
@@ -453,10 +471,15 @@ FJsonObjectParameter UMCPSlateTools::HandleFindWidgetsByType(const FJsonObjectPa
 			FoundWidgets, MaxDepth, 0);
 	}
 
+	// 深度优先遍历顺序本身稳定，按位置分页
+	Page.ApplyOrdered(FoundWidgets);
+	ProjectFields(FoundWidgets, Page.GetFields());
+
 	FJsonObjectParameter Result = MakeShared<FJsonObject>();
 	Result->SetArrayField(TEXT("widgets"), FoundWidgets);
 	Result->SetNumberField(TEXT("count"),  FoundWidgets.Num());
 	Result->SetStringField(TEXT("searched_type"), TypeName);
+	Page.SetPageInfo(*Result.GetJsonObject());
 	return Result;
 }
 
@@ -985,16 +1008,25 @@ FJsonObjectParameter UMCPSlateTools::HandleGetAllDockTabs(const FJsonObjectParam
 	if (!FSlateApplication::IsInitialized())
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("SlateApplication not initialized"));
 
+	FMCPPageRequest Page;
+	FString PageError;
+	if (!Page.Parse(Params, TEXT("dock_tabs"), PageError))
+		return FUnrealMCPCommonUtils::CreateErrorResponse(PageError);
+
 	TArray<TSharedPtr<FJsonValue>> AllTabs;
 	for (const TSharedRef<SWindow>& Win : FSlateApplication::Get().GetTopLevelWindows())
 	{
 		FindDockTabsRecursive(Win->GetContent(), AllTabs, Win->GetTitle().ToString(), 20, 0);
 	}
 
+	Page.ApplyOrdered(AllTabs);
+	ProjectFields(AllTabs, Page.GetFields());
+
 	FJsonObjectParameter Result = MakeShared<FJsonObject>();
 	Result->SetBoolField  (TEXT("success"), true);
 	Result->SetArrayField (TEXT("tabs"),    AllTabs);
 	Result->SetNumberField(TEXT("count"),   AllTabs.Num());
+	Page.SetPageInfo(*Result.GetJsonObject());
 	return Result;
 }
 
@@ -0,0 +1,194 @@
+#include "MCPTools/MCPSnapshotStore.h"
+
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+namespace MCPSnapshotStore
+{
+	// a handful of try-and-revert loops; the byte cap keeps a snapshot of a whole level from pinning memory
+	static constexpr int32 MaxSnapshots = 16;
+	static constexpr int64 MaxTotalBytes = 256ll * 1024 * 1024;
+
+	/**
+	 * Object references as paths. Instanced references (an actor's RootComponent, its component arrays) are skipped:
+	 * a construction script rerun replaces those components, and restoring the old path would point the actor at the
+	 * discarded ones.
+	 */
+	class FSnapshotArchive final : public FObjectAndNameAsStringProxyArchive
+	{
+	public:
+		explicit FSnapshotArchive(FArchive& InInnerArchive)
+			: FObjectAndNameAsStringProxyArchive(InInnerArchive, false)
+		{
+		}
+
+		virtual bool ShouldSkipProperty(const FProperty* InProperty) const override
+		{
+			return InProperty->HasAnyPropertyFlags(CPF_InstancedReference | CPF_ContainsInstancedReference)
+				|| FObjectAndNameAsStringProxyArchive::ShouldSkipProperty(InProperty);
+		}
+	};
+
+	static void Save(UObject* Object, TArray<uint8>& OutData)
+	{
+		FMemoryWriter Writer(OutData, true);
+		FSnapshotArchive Archive(Writer);
+		Object->Serialize(Archive);
+	}
+
+	static void Load(UObject* Object, const TArray<uint8>& Data)
+	{
+		FMemoryReader Reader(Data, true);
+		FSnapshotArchive Archive(Reader);
+		Object->Serialize(Archive);
+	}
+}
+
+FMCPSnapshotStore& FMCPSnapshotStore::Get()
+{
+	static FMCPSnapshotStore Store;
+	return Store;
+}
+
+FString FMCPSnapshotStore::Capture(const TArray<AActor*>& Actors)
+{
+	TSharedRef<FSnapshot> Snapshot = MakeShared<FSnapshot>();
+	Snapshot->Id = FString::Printf(TEXT("snap_%d"), NextId++);
+	Snapshot->Created = FDateTime::UtcNow();
+	Snapshot->Actors.Reserve(Actors.Num());
+
+	for (AActor* Actor : Actors)
+	{
+		if (!IsValid(Actor))
+		{
+			continue;
+		}
+
+		FActorRecord& Record = Snapshot->Actors.AddDefaulted_GetRef();
+		Record.Actor = Actor;
+		Record.Path = Actor->GetPathName();
+		MCPSnapshotStore::Save(Actor, Record.Data);
+		Snapshot->Bytes += Record.Data.Num();
+
+		TInlineComponentArray<UActorComponent*> Components(Actor);
+		Record.Components.Reserve(Components.Num());
+		for (UActorComponent* Component : Components)
+		{
+			FComponentRecord& ComponentRecord = Record.Components.AddDefaulted_GetRef();
+			ComponentRecord.Component = Component;
+			ComponentRecord.Name = Component->GetFName();
+			MCPSnapshotStore::Save(Component, ComponentRecord.Data);
+			Snapshot->Bytes += ComponentRecord.Data.Num();
+		}
+	}
+
+	TotalBytes += Snapshot->Bytes;
+	Snapshots.Add(Snapshot);
+	Evict();
+	return Snapshot->Id;
+}
+
+bool FMCPSnapshotStore::Restore(const FString& Id, TArray<AActor*>& OutRestored, TArray<FString>& OutMissing, FString& OutError)
+{
+	TSharedPtr<FSnapshot> Snapshot = Touch(Id);
+	if (!Snapshot.IsValid())
+	{
+		OutError = FString::Printf(TEXT("Snapshot not found: %s"), *Id);
+		return false;
+	}
+
+	for (FActorRecord& Record : Snapshot->Actors)
+	{
+		AActor* Actor = Record.Actor.Get();
+		if (!IsValid(Actor))
+		{
+			OutMissing.Add(Record.Path);
+			continue;
+		}
+
+		// components first, so the actor's PostEditChange (and a Blueprint construction script rerun) sees their
+		// restored state
+		TArray<UActorComponent*, TInlineAllocator<16>> Restored;
+		for (FComponentRecord& ComponentRecord : Record.Components)
+		{
+			UActorComponent* Component = ComponentRecord.Component.Get();
+			if (!IsValid(Component))
+			{
+				// construction script components are recreated on every rerun; find the replacement by name
+				Component = FindObjectFast<UActorComponent>(Actor, ComponentRecord.Name);
+			}
+			if (!IsValid(Component) || Component->GetOwner() != Actor)
+			{
+				continue;
+			}
+			Component->Modify();
+			MCPSnapshotStore::Load(Component, ComponentRecord.Data);
+			Restored.Add(Component);
+		}
+
+		Actor->Modify();
+		MCPSnapshotStore::Load(Actor, Record.Data);
+
+		for (UActorComponent* Component : Restored)
+		{
+			Component->PostEditChange();
+		}
+		Actor->PostEditMove(true);
+		Actor->PostEditChange();
+		OutRestored.Add(Actor);
+	}
+	return true;
+}
+
+void FMCPSnapshotStore::GetSnapshots(TArray<TSharedRef<const FSnapshot>>& Out) const
+{
+	Out.Reset(Snapshots.Num());
+	for (int32 Index = Snapshots.Num() - 1; Index >= 0; --Index)
+	{
+		Out.Add(Snapshots[Index]);
+	}
+}
+
+bool FMCPSnapshotStore::Remove(const FString& Id)
+{
+	const int32 Index = Snapshots.IndexOfByPredicate([&Id](const TSharedRef<FSnapshot>& Snapshot) { return Snapshot->Id == Id; });
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+	TotalBytes -= Snapshots[Index]->Bytes;
+	Snapshots.RemoveAt(Index);
+	return true;
+}
+
+void FMCPSnapshotStore::Reset()
+{
+	Snapshots.Reset();
+	TotalBytes = 0;
+}
+
+TSharedPtr<FMCPSnapshotStore::FSnapshot> FMCPSnapshotStore::Touch(const FString& Id)
+{
+	const int32 Index = Snapshots.IndexOfByPredicate([&Id](const TSharedRef<FSnapshot>& Snapshot) { return Snapshot->Id == Id; });
+	if (Index == INDEX_NONE)
+	{
+		return nullptr;
+	}
+	TSharedRef<FSnapshot> Snapshot = Snapshots[Index];
+	Snapshots.RemoveAt(Index);
+	Snapshots.Add(Snapshot);
+	return Snapshot;
+}
+
+void FMCPSnapshotStore::Evict()
+{
+	// the newest snapshot is always kept, even when it alone exceeds the byte cap
+	while (Snapshots.Num() > 1 && (Snapshots.Num() > MCPSnapshotStore::MaxSnapshots || TotalBytes > MCPSnapshotStore::MaxTotalBytes))
+	{
+		TotalBytes -= Snapshots[0]->Bytes;
+		Snapshots.RemoveAt(0);
+	}
+}
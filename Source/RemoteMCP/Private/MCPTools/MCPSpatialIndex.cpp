@@ -0,0 +1,387 @@
+#include "MCPTools/MCPSpatialIndex.h"
+
+#include "Editor.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "MCPTools/MCPActorIndex.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace MCPSpatialIndex
+{
+	// 20m cells; most props and lights fit in one or two
+	static constexpr double CellSize = 2000.0;
+	// bounds spanning more cells than this along any axis go to the overflow list
+	static constexpr int32 MaxCellsPerAxis = 8;
+
+	static bool IsTransformProperty(FName PropertyName)
+	{
+		return PropertyName == USceneComponent::GetRelativeLocationPropertyName()
+			|| PropertyName == USceneComponent::GetRelativeRotationPropertyName()
+			|| PropertyName == USceneComponent::GetRelativeScale3DPropertyName();
+	}
+}
+
+FMCPSpatialIndex& FMCPSpatialIndex::Get()
+{
+	static FMCPSpatialIndex Index;
+	return Index;
+}
+
+void FMCPSpatialIndex::Initialize()
+{
+	if (GEngine)
+	{
+		ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPSpatialIndex::OnLevelActorAdded);
+		ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPSpatialIndex::OnLevelActorDeleted);
+		ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FMCPSpatialIndex::Invalidate);
+		ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FMCPSpatialIndex::OnActorMoved);
+	}
+	MapChangeHandle = FEditorDelegates::MapChange.AddLambda([this](uint32) { Invalidate(); });
+
+	PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FMCPSpatialIndex::OnObjectPropertyChanged);
+}
+
+void FMCPSpatialIndex::Shutdown()
+{
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+		GEngine->OnActorMoved().Remove(ActorMovedHandle);
+	}
+	FEditorDelegates::MapChange.Remove(MapChangeHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+
+	Invalidate();
+	World.Reset();
+}
+
+void FMCPSpatialIndex::Invalidate()
+{
+	bDirty = true;
+	Entries.Reset();
+	Cells.Reset();
+	Overflow.Reset();
+	GridBounds.Init();
+}
+
+void FMCPSpatialIndex::EnsureBuilt()
+{
+	UWorld* CurrentWorld = GWorld;
+	if (!bDirty && World.Get() == CurrentWorld)
+	{
+		return;
+	}
+
+	Invalidate();
+	World = CurrentWorld;
+
+	TArray<AActor*> Actors;
+	FMCPActorIndex::Get().GetAllActors(Actors);
+	Entries.Reserve(Actors.Num());
+	for (AActor* Actor : Actors)
+	{
+		AddActor(Actor);
+	}
+	bDirty = false;
+}
+
+FIntVector FMCPSpatialIndex::ToCell(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / MCPSpatialIndex::CellSize),
+		FMath::FloorToInt32(Location.Y / MCPSpatialIndex::CellSize),
+		FMath::FloorToInt32(Location.Z / MCPSpatialIndex::CellSize));
+}
+
+void FMCPSpatialIndex::AddActor(AActor* Actor)
+{
+	if (!IsValid(Actor) || !World.IsValid() || Actor->GetWorld() != World.Get())
+	{
+		return;
+	}
+
+	const FObjectKey Key(Actor);
+	RemoveEntry(Key);
+
+	FBox Bounds = Actor->GetComponentsBoundingBox(true);
+	if (!Bounds.IsValid)
+	{
+		// lights, empties and other actors without primitives are indexed as a point
+		Bounds = FBox(Actor->GetActorLocation(), Actor->GetActorLocation());
+	}
+
+	FEntry& Entry = Entries.Add(Key);
+	Entry.Actor = Actor;
+	Entry.Bounds = Bounds;
+	Entry.MinCell = ToCell(Bounds.Min);
+	Entry.MaxCell = ToCell(Bounds.Max);
+	const FIntVector Span = Entry.MaxCell - Entry.MinCell;
+	Entry.bOverflow = Span.GetMax() >= MCPSpatialIndex::MaxCellsPerAxis;
+	GridBounds += Bounds;
+
+	if (Entry.bOverflow)
+	{
+		Overflow.Add(Key);
+		return;
+	}
+	for (int32 X = Entry.MinCell.X; X <= Entry.MaxCell.X; ++X)
+	{
+		for (int32 Y = Entry.MinCell.Y; Y <= Entry.MaxCell.Y; ++Y)
+		{
+			for (int32 Z = Entry.MinCell.Z; Z <= Entry.MaxCell.Z; ++Z)
+			{
+				Cells.FindOrAdd(FIntVector(X, Y, Z)).Add(Key);
+			}
+		}
+	}
+}
+
+void FMCPSpatialIndex::RemoveEntry(const FObjectKey& Key)
+{
+	FEntry Entry;
+	if (!Entries.RemoveAndCopyValue(Key, Entry))
+	{
+		return;
+	}
+
+	// GridBounds only grows; it is a search limit, not an exact extent
+	if (Entry.bOverflow)
+	{
+		Overflow.RemoveSingleSwap(Key);
+		return;
+	}
+	for (int32 X = Entry.MinCell.X; X <= Entry.MaxCell.X; ++X)
+	{
+		for (int32 Y = Entry.MinCell.Y; Y <= Entry.MaxCell.Y; ++Y)
+		{
+			for (int32 Z = Entry.MinCell.Z; Z <= Entry.MaxCell.Z; ++Z)
+			{
+				const FIntVector Cell(X, Y, Z);
+				if (TArray<FObjectKey>* Keys = Cells.Find(Cell))
+				{
+					Keys->RemoveSingleSwap(Key);
+					if (Keys->IsEmpty())
+					{
+						Cells.Remove(Cell);
+					}
+				}
+			}
+		}
+	}
+}
+
+template<typename VisitorType>
+void FMCPSpatialIndex::ForEachEntry(VisitorType&& Visitor)
+{
+	for (const TPair<FObjectKey, FEntry>& Pair : Entries)
+	{
+		Visitor(Pair.Value);
+	}
+}
+
+template<typename VisitorType>
+void FMCPSpatialIndex::ForEachCandidate(const FBox& Box, VisitorType&& Visitor)
+{
+	for (const FObjectKey& Key : Overflow)
+	{
+		Visitor(Entries.FindChecked(Key));
+	}
+
+	const FBox Clipped = Box.Overlap(GridBounds);
+	if (!Clipped.IsValid)
+	{
+		return;
+	}
+
+	const FIntVector RangeMin = ToCell(Clipped.Min);
+	const FIntVector RangeMax = ToCell(Clipped.Max);
+	const FIntVector Span = RangeMax - RangeMin + FIntVector(1);
+	// a query covering most of the level is cheaper as a plain walk over the entries
+	if (static_cast<int64>(Span.X) * Span.Y * Span.Z > Entries.Num())
+	{
+		for (const TPair<FObjectKey, FEntry>& Pair : Entries)
+		{
+			if (!Pair.Value.bOverflow)
+			{
+				Visitor(Pair.Value);
+			}
+		}
+		return;
+	}
+
+	for (int32 X = RangeMin.X; X <= RangeMax.X; ++X)
+	{
+		for (int32 Y = RangeMin.Y; Y <= RangeMax.Y; ++Y)
+		{
+			for (int32 Z = RangeMin.Z; Z <= RangeMax.Z; ++Z)
+			{
+				const TArray<FObjectKey>* Keys = Cells.Find(FIntVector(X, Y, Z));
+				if (!Keys)
+				{
+					continue;
+				}
+				for (const FObjectKey& Key : *Keys)
+				{
+					// an entry spanning several cells is reported only from the first cell of the range it overlaps
+					const FEntry& Entry = Entries.FindChecked(Key);
+					if (X == FMath::Max(Entry.MinCell.X, RangeMin.X)
+						&& Y == FMath::Max(Entry.MinCell.Y, RangeMin.Y)
+						&& Z == FMath::Max(Entry.MinCell.Z, RangeMin.Z))
+					{
+						Visitor(Entry);
+					}
+				}
+			}
+		}
+	}
+}
+
+static void SortHits(TArray<FMCPSpatialIndex::FHit>& Hits)
+{
+	Hits.Sort([](const FMCPSpatialIndex::FHit& A, const FMCPSpatialIndex::FHit& B)
+	{
+		return A.Distance < B.Distance;
+	});
+}
+
+void FMCPSpatialIndex::QueryRadius(const FVector& Center, double Radius, TArray<FHit>& OutHits)
+{
+	EnsureBuilt();
+	const double RadiusSquared = FMath::Square(Radius);
+	ForEachCandidate(FBox(Center - FVector(Radius), Center + FVector(Radius)), [&](const FEntry& Entry)
+	{
+		AActor* Actor = Entry.Actor.Get();
+		const double DistanceSquared = Entry.Bounds.ComputeSquaredDistanceToPoint(Center);
+		if (IsValid(Actor) && DistanceSquared <= RadiusSquared)
+		{
+			OutHits.Add({ Actor, FMath::Sqrt(DistanceSquared) });
+		}
+	});
+	SortHits(OutHits);
+}
+
+void FMCPSpatialIndex::QueryBox(const FBox& Box, bool bFullyInside, TArray<FHit>& OutHits)
+{
+	EnsureBuilt();
+	const FVector Center = Box.GetCenter();
+	ForEachCandidate(Box, [&](const FEntry& Entry)
+	{
+		AActor* Actor = Entry.Actor.Get();
+		const bool bMatch = bFullyInside ? Box.IsInside(Entry.Bounds) : Box.Intersect(Entry.Bounds);
+		if (IsValid(Actor) && bMatch)
+		{
+			OutHits.Add({ Actor, FMath::Sqrt(Entry.Bounds.ComputeSquaredDistanceToPoint(Center)) });
+		}
+	});
+	SortHits(OutHits);
+}
+
+void FMCPSpatialIndex::QueryFrustum(const FConvexVolume& Frustum, const FVector& Origin, double MaxDistance, TArray<FHit>& OutHits)
+{
+	EnsureBuilt();
+	auto Visit = [&](const FEntry& Entry)
+	{
+		AActor* Actor = Entry.Actor.Get();
+		if (!IsValid(Actor) || !Frustum.IntersectBox(Entry.Bounds.GetCenter(), Entry.Bounds.GetExtent()))
+		{
+			return;
+		}
+		const double Distance = FMath::Sqrt(Entry.Bounds.ComputeSquaredDistanceToPoint(Origin));
+		if (MaxDistance <= 0.0 || Distance <= MaxDistance)
+		{
+			OutHits.Add({ Actor, Distance });
+		}
+	};
+
+	// the editor's perspective frustum has no far plane, so without a distance every entry is a candidate
+	if (MaxDistance > 0.0)
+	{
+		ForEachCandidate(FBox(Origin - FVector(MaxDistance), Origin + FVector(MaxDistance)), Visit);
+	}
+	else
+	{
+		ForEachEntry(Visit);
+	}
+	SortHits(OutHits);
+}
+
+void FMCPSpatialIndex::QueryNearest(const FVector& Center, int32 Count, double MaxDistance, TArray<FHit>& OutHits)
+{
+	EnsureBuilt();
+	if (Count <= 0 || !GridBounds.IsValid)
+	{
+		return;
+	}
+
+	// farthest distance any indexed bounds can be from Center; once the search radius reaches it, nothing is left out
+	const FVector Far = FVector::Max(Center - GridBounds.Min, GridBounds.Max - Center);
+	double Limit = Far.Size();
+	if (MaxDistance > 0.0)
+	{
+		Limit = FMath::Min(Limit, MaxDistance);
+	}
+
+	// grow the search sphere until it holds Count actors; every actor inside it is nearer than any actor outside
+	double Radius = FMath::Min(MCPSpatialIndex::CellSize, Limit);
+	for (;;)
+	{
+		OutHits.Reset();
+		QueryRadius(Center, Radius, OutHits);
+		if (OutHits.Num() >= Count || Radius >= Limit)
+		{
+			break;
+		}
+		Radius = FMath::Min(Radius * 2.0, Limit);
+	}
+
+	if (OutHits.Num() > Count)
+	{
+		OutHits.SetNum(Count);
+	}
+}
+
+void FMCPSpatialIndex::NotifyActorMoved(AActor* Actor)
+{
+	if (!bDirty && Actor)
+	{
+		AddActor(Actor);
+	}
+}
+
+void FMCPSpatialIndex::OnLevelActorAdded(AActor* Actor)
+{
+	if (!bDirty)
+	{
+		AddActor(Actor);
+	}
+}
+
+void FMCPSpatialIndex::OnLevelActorDeleted(AActor* Actor)
+{
+	if (!bDirty)
+	{
+		RemoveEntry(FObjectKey(Actor));
+	}
+}
+
+void FMCPSpatialIndex::OnActorMoved(AActor* Actor)
+{
+	NotifyActorMoved(Actor);
+}
+
+void FMCPSpatialIndex::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+	// details panel edits of a component transform do not always go through PostEditMove
+	if (bDirty || !MCPSpatialIndex::IsTransformProperty(Event.GetPropertyName()))
+	{
+		return;
+	}
+	if (const USceneComponent* Component = Cast<USceneComponent>(Object))
+	{
+		NotifyActorMoved(Component->GetOwner());
+	}
+}
@@ -0,0 +1,302 @@
+#include "MCPTools/MCPSymbolIndex.h"
+
+#include "Algo/LevenshteinDistance.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "MCPTools/MCPBlueprintResolver.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectIterator.h"
+
+namespace MCPSymbolIndex
+{
+	/** "UGameplayStatics" -> "GameplayStatics"; names that merely start with U or A ("Utility") are left alone. */
+	static bool StripPrefix(const FString& Name, FString& OutStripped)
+	{
+		if (Name.Len() < 3 || (Name[0] != TEXT('U') && Name[0] != TEXT('A')) || !FChar::IsUpper(Name[1]))
+		{
+			return false;
+		}
+		OutStripped = Name.RightChop(1);
+		return true;
+	}
+
+	static bool IsA(const UClass* Class, const UClass* BaseClass)
+	{
+		return Class && (!BaseClass || Class->IsChildOf(BaseClass));
+	}
+
+	static UClass* GetGeneratedClass(const FString& BlueprintName)
+	{
+		FString Error;
+		const UBlueprint* Blueprint = FMCPBlueprintResolver::Get().Resolve(BlueprintName, Error);
+		return Blueprint ? Blueprint->GeneratedClass.Get() : nullptr;
+	}
+}
+
+FMCPSymbolIndex& FMCPSymbolIndex::Get()
+{
+	static FMCPSymbolIndex Index;
+	return Index;
+}
+
+void FMCPSymbolIndex::Initialize()
+{
+	// the delegate's parameters differ between engine versions; any broadcast means new native classes exist
+	ClassesRegisteredHandle = FCoreUObjectDelegates::CompiledInUObjectsRegisteredDelegate.AddLambda([this](auto&&...) { ResetClasses(); });
+	ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddLambda([this](FName, EModuleChangeReason Reason)
+	{
+		if (Reason == EModuleChangeReason::ModuleUnloaded)
+		{
+			Reset();
+		}
+	});
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason) { Reset(); });
+	ReinstancedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda([this](const TMap<UObject*, UObject*>&) { ResetFunctions(); });
+	if (GEditor)
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FMCPSymbolIndex::ResetFunctions);
+	}
+}
+
+void FMCPSymbolIndex::Shutdown()
+{
+	FCoreUObjectDelegates::CompiledInUObjectsRegisteredDelegate.Remove(ClassesRegisteredHandle);
+	FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ReinstancedHandle);
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+	Reset();
+}
+
+UClass* FMCPSymbolIndex::FindClass(const FString& Name, const UClass* BaseClass)
+{
+	if (Name.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	if (Name.StartsWith(TEXT("/")))
+	{
+		// "/Script/Engine.GameplayStatics" or a generated class path are class paths; anything else names a Blueprint asset
+		UClass* Class = Name.StartsWith(TEXT("/Script/")) || Name.EndsWith(TEXT("_C"))
+			? StaticLoadClass(UObject::StaticClass(), nullptr, *Name, nullptr, LOAD_NoWarn)
+			: MCPSymbolIndex::GetGeneratedClass(Name);
+		return MCPSymbolIndex::IsA(Class, BaseClass) ? Class : nullptr;
+	}
+
+	if (!bClassesIndexed)
+	{
+		BuildClassIndex();
+	}
+
+	FString Stripped;
+	UClass* Class = FindNative(Name, BaseClass);
+	if (!Class && MCPSymbolIndex::StripPrefix(Name, Stripped))
+	{
+		Class = FindNative(Stripped, BaseClass);
+	}
+	if (Class)
+	{
+		return Class;
+	}
+
+	// a Blueprint, given by asset name ("BPFL_Math") or generated class name ("BPFL_Math_C")
+	Class = MCPSymbolIndex::GetGeneratedClass(Name.EndsWith(TEXT("_C")) ? Name.LeftChop(2) : Name);
+	if (MCPSymbolIndex::IsA(Class, BaseClass))
+	{
+		return Class;
+	}
+
+	// the name without its family prefix: "CallFunction" -> K2Node_CallFunction, accepted only when unambiguous
+	if (BaseClass)
+	{
+		const FString Suffix = TEXT("_") + Name;
+		UClass* Match = nullptr;
+		for (UClass* Candidate : GetSubclasses(BaseClass))
+		{
+			if (Candidate->GetName().EndsWith(Suffix))
+			{
+				if (Match)
+				{
+					return nullptr;
+				}
+				Match = Candidate;
+			}
+		}
+		return Match;
+	}
+	return nullptr;
+}
+
+UClass* FMCPSymbolIndex::FindClass(const FString& Name, const UClass* BaseClass, FString& OutError)
+{
+	if (UClass* Class = FindClass(Name, BaseClass))
+	{
+		return Class;
+	}
+
+	OutError = BaseClass
+		? FString::Printf(TEXT("%s class not found: %s"), *BaseClass->GetName(), *Name)
+		: FString::Printf(TEXT("Class not found: %s"), *Name);
+	TArray<FString> Suggestions;
+	SuggestClasses(Name, BaseClass, Suggestions);
+	if (!Suggestions.IsEmpty())
+	{
+		OutError += FString::Printf(TEXT(". Did you mean: %s?"), *FString::Join(Suggestions, TEXT(", ")));
+	}
+	return nullptr;
+}
+
+void FMCPSymbolIndex::SuggestClasses(const FString& Name, const UClass* BaseClass, TArray<FString>& OutNames, int32 MaxCount)
+{
+	OutNames.Reset();
+	// "/Script/Engine.GameplayStatic" suggests by its short name
+	FString Needle = Name;
+	int32 Dot = INDEX_NONE;
+	if (Needle.FindLastChar(TEXT('.'), Dot))
+	{
+		Needle.RightChopInline(Dot + 1);
+	}
+	Needle.ToLowerInline();
+	if (Needle.IsEmpty())
+	{
+		return;
+	}
+	const int32 MaxDistance = FMath::Max(2, Needle.Len() / 3);
+
+	// containing the name ranks above any edit, then fewer edits, then shorter names
+	TArray<TPair<int32, FString>> Scored;
+	for (const UClass* Candidate : GetSubclasses(BaseClass))
+	{
+		FString CandidateName = Candidate->GetName();
+		const FString Lower = CandidateName.ToLower();
+		int32 Score = INDEX_NONE;
+		if (Lower.Contains(Needle))
+		{
+			Score = 0;
+		}
+		else if (FMath::Abs(Lower.Len() - Needle.Len()) <= MaxDistance)
+		{
+			// cheap length check first: most of a large class list is discarded without computing a distance
+			const int32 Distance = static_cast<int32>(Algo::LevenshteinDistance(Lower, Needle));
+			Score = Distance <= MaxDistance ? Distance + 1 : INDEX_NONE;
+		}
+		if (Score != INDEX_NONE)
+		{
+			Scored.Emplace(Score, MoveTemp(CandidateName));
+		}
+	}
+
+	Scored.Sort([](const TPair<int32, FString>& A, const TPair<int32, FString>& B)
+	{
+		return A.Key != B.Key ? A.Key < B.Key : A.Value.Len() < B.Value.Len();
+	});
+	for (int32 Index = 0; Index < Scored.Num() && OutNames.Num() < MaxCount; ++Index)
+	{
+		OutNames.AddUnique(MoveTemp(Scored[Index].Value));
+	}
+}
+
+UFunction* FMCPSymbolIndex::FindFunction(const UClass* Class, const FString& Name)
+{
+	if (!Class)
+	{
+		return nullptr;
+	}
+	const FName FunctionName(*Name, FNAME_Find);
+	if (FunctionName.IsNone())
+	{
+		return nullptr;
+	}
+
+	TMap<FName, UFunction*>* Table = Functions.Find(FObjectKey(Class));
+	if (!Table)
+	{
+		Table = &Functions.Add(FObjectKey(Class));
+		// most derived first, so an override shadows the function it overrides
+		for (TFieldIterator<UFunction> It(Class, EFieldIteratorFlags::IncludeSuper); It; ++It)
+		{
+			Table->FindOrAdd(It->GetFName(), *It);
+		}
+	}
+
+	UFunction* const* Found = Table->Find(FunctionName);
+	return Found ? *Found : nullptr;
+}
+
+void FMCPSymbolIndex::Reset()
+{
+	ResetClasses();
+	ResetFunctions();
+}
+
+void FMCPSymbolIndex::BuildClassIndex()
+{
+	Classes.Reset();
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		if (Class->HasAnyClassFlags(CLASS_Native) && !Class->HasAnyClassFlags(CLASS_NewerVersionExists))
+		{
+			Classes.Add(Class->GetFName(), Class);
+		}
+	}
+	bClassesIndexed = true;
+}
+
+const TArray<UClass*>& FMCPSymbolIndex::GetSubclasses(const UClass* BaseClass)
+{
+	if (!bClassesIndexed)
+	{
+		BuildClassIndex();
+	}
+
+	const UClass* Base = BaseClass ? BaseClass : UObject::StaticClass();
+	if (const TArray<UClass*>* Found = Subclasses.Find(FObjectKey(Base)))
+	{
+		return *Found;
+	}
+
+	TArray<UClass*>& List = Subclasses.Add(FObjectKey(Base));
+	for (const TPair<FName, UClass*>& Pair : Classes)
+	{
+		if (Pair.Value->IsChildOf(Base))
+		{
+			List.Add(Pair.Value);
+		}
+	}
+	return List;
+}
+
+UClass* FMCPSymbolIndex::FindNative(const FString& Name, const UClass* BaseClass) const
+{
+	// FNAME_Find: a name nobody has registered cannot be a class, and typos should not grow the name table
+	const FName Key(*Name, FNAME_Find);
+	if (Key.IsNone())
+	{
+		return nullptr;
+	}
+	for (auto It = Classes.CreateConstKeyIterator(Key); It; ++It)
+	{
+		if (MCPSymbolIndex::IsA(It.Value(), BaseClass))
+		{
+			return It.Value();
+		}
+	}
+	return nullptr;
+}
+
+void FMCPSymbolIndex::ResetClasses()
+{
+	Classes.Reset();
+	Subclasses.Reset();
+	bClassesIndexed = false;
+}
+
+void FMCPSymbolIndex::ResetFunctions()
+{
+	Functions.Reset();
+}
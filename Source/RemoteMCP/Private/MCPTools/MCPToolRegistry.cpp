@@ -0,0 +1,443 @@
+#include "MCPTools/MCPToolRegistry.h"
+
+#include "MCPMisc.h"
+#include "MCPTools/MCPBehaviorTreeTools.h"
+#include "MCPTools/MCPBlueprintTools.h"
+#include "MCPTools/MCPEdGraphTools.h"
+#include "MCPTools/MCPEditorTools.h"
+#include "MCPTools/MCPSlateTools.h"
+#include "MCPTools/MCPUMGTools.h"
+#include "MCPTools/UnrealMCPCommonUtils.h"
+#include "ScopedTransaction.h"
+
+#define MCP_REGISTER_TOOL(ClassName, HandlerName) \
+	RegisterTool(TEXT(#ClassName "." #HandlerName), &U##ClassName::HandlerName, HasThreadSafeMeta(U##ClassName::StaticClass(), TEXT(#HandlerName)))
+
+namespace
+{
+	const TCHAR* BatchRefPrefix = TEXT("$ref:");
+	const TCHAR* GameThreadRequiredField = TEXT("requires_game_thread");
+
+	bool HasThreadSafeMeta(const UClass* Class, const TCHAR* FunctionName)
+	{
+#if WITH_METADATA
+		const UFunction* Function = Class->FindFunctionByName(FunctionName);
+		return Function && Function->HasMetaData(TEXT("MCPThreadSafe"));
+#else
+		return false;
+#endif
+	}
+
+	/** Resolve "<step>.<path>" against the results of the steps already run. */
+	TSharedPtr<FJsonValue> ResolveBatchRef(const FString& RefPath, const TArray<TSharedPtr<FJsonObject>>& StepResults,
+		const TMap<FString, int32>& StepIds, FString& OutError)
+	{
+		TArray<FString> Segments;
+		RefPath.ParseIntoArray(Segments, TEXT("."));
+		if (Segments.Num() == 0)
+		{
+			OutError = TEXT("Empty $ref");
+			return nullptr;
+		}
+
+		int32 StepIndex = INDEX_NONE;
+		if (const int32* FoundIndex = StepIds.Find(Segments[0]))
+		{
+			StepIndex = *FoundIndex;
+		}
+		else if (Segments[0].IsNumeric())
+		{
+			StepIndex = FCString::Atoi(*Segments[0]);
+		}
+		if (!StepResults.IsValidIndex(StepIndex) || !StepResults[StepIndex].IsValid())
+		{
+			OutError = FString::Printf(TEXT("$ref step '%s' has not run"), *Segments[0]);
+			return nullptr;
+		}
+
+		TSharedPtr<FJsonValue> Current = MakeShared<FJsonValueObject>(StepResults[StepIndex]);
+		for (int32 SegmentIndex = 1; SegmentIndex < Segments.Num(); ++SegmentIndex)
+		{
+			const FString& Segment = Segments[SegmentIndex];
+			if (Current->Type == EJson::Object)
+			{
+				Current = Current->AsObject()->TryGetField(Segment);
+			}
+			else if (Current->Type == EJson::Array && Segment.IsNumeric())
+			{
+				const TArray<TSharedPtr<FJsonValue>>& Array = Current->AsArray();
+				const int32 ArrayIndex = FCString::Atoi(*Segment);
+				Current = Array.IsValidIndex(ArrayIndex) ? Array[ArrayIndex] : nullptr;
+			}
+			else
+			{
+				Current = nullptr;
+			}
+
+			if (!Current.IsValid())
+			{
+				OutError = FString::Printf(TEXT("$ref '%s': '%s' not found"), *RefPath, *Segment);
+				return nullptr;
+			}
+		}
+		return Current;
+	}
+
+	/** Copy Value, replacing every "$ref:..." string by the referenced value. */
+	TSharedPtr<FJsonValue> SubstituteBatchRefs(const TSharedPtr<FJsonValue>& Value, const TArray<TSharedPtr<FJsonObject>>& StepResults,
+		const TMap<FString, int32>& StepIds, FString& OutError)
+	{
+		if (!Value.IsValid())
+		{
+			return Value;
+		}
+
+		switch (Value->Type)
+		{
+		case EJson::String:
+			{
+				const FString& Str = Value->AsString();
+				if (Str.StartsWith(BatchRefPrefix))
+				{
+					return ResolveBatchRef(Str.RightChop(FCString::Strlen(BatchRefPrefix)), StepResults, StepIds, OutError);
+				}
+				return Value;
+			}
+		case EJson::Object:
+			{
+				TSharedPtr<FJsonObject> Copy = MakeShared<FJsonObject>();
+				for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Value->AsObject()->Values)
+				{
+					TSharedPtr<FJsonValue> Substituted = SubstituteBatchRefs(Field.Value, StepResults, StepIds, OutError);
+					if (!OutError.IsEmpty())
+					{
+						return nullptr;
+					}
+					Copy->SetField(Field.Key, Substituted);
+				}
+				return MakeShared<FJsonValueObject>(Copy);
+			}
+		case EJson::Array:
+			{
+				TArray<TSharedPtr<FJsonValue>> Copy;
+				for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+				{
+					Copy.Add(SubstituteBatchRefs(Element, StepResults, StepIds, OutError));
+					if (!OutError.IsEmpty())
+					{
+						return nullptr;
+					}
+				}
+				return MakeShared<FJsonValueArray>(Copy);
+			}
+		default:
+			return Value;
+		}
+	}
+}
+
+FMCPToolRegistry& FMCPToolRegistry::Get()
+{
+	static FMCPToolRegistry Registry;
+	return Registry;
+}
+
+void FMCPToolRegistry::RegisterBuiltinTools()
+{
+	// Editor / level
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleGetActorsInLevel);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleFindActorsByName);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleFindActorsInRadius);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleFindActorsInBox);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleFindActorsInViewFrustum);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleFindNearestActors);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleGetActorChangesSince);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleSpawnActor);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleDeleteActor);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleSetActorTransform);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleGetActorProperties);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleSetActorProperty);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleBulkSetActorTransforms);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleBulkSetActorProperties);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleSpawnBlueprintActor);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleBulkSpawnActors);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleSnapshotActors);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleRestoreSnapshot);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleFocusViewport);
+	MCP_REGISTER_TOOL(MCPEditorTools, HandleTakeScreenshot);
+
+	// Blueprint
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleCreateBlueprint);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleAddComponentToBlueprint);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleSetComponentProperty);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleSetPhysicsProperties);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleCompileBlueprint);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleSpawnBlueprintActor);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleSetBlueprintProperty);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleSetStaticMeshProperties);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleSetPawnProperties);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleConnectBlueprintNodes);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleAddBlueprintGetSelfComponentReference);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleAddBlueprintEvent);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleAddBlueprintFunctionCall);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleAddBlueprintVariable);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleAddBlueprintInputActionNode);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleAddBlueprintSelfReference);
+	MCP_REGISTER_TOOL(MCPBlueprintTools, HandleFindBlueprintNodes);
+
+	// EdGraph
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleFindGraphsInAsset);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleListGraphNodes);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleGetGraphNode);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleDeleteGraphNode);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleSetNodeProperties);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleListGraphLinks);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleConnectPins);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleDisconnectPin);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleAddCommentNode);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleAddNode);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleSetPinDefaultValue);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleApplyGraphPatch);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleCompileAsset);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleCreateGraph);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleDeleteGraph);
+	MCP_REGISTER_TOOL(MCPEdGraphTools, HandleGetAssetInfo);
+
+	// Behavior tree
+	MCP_REGISTER_TOOL(MCPBehaviorTreeTools, HandleGetBehaviorTreeGraph);
+	MCP_REGISTER_TOOL(MCPBehaviorTreeTools, HandleCreateBehaviorTree);
+	MCP_REGISTER_TOOL(MCPBehaviorTreeTools, HandleGetBTAuxiliaryNodes);
+	MCP_REGISTER_TOOL(MCPBehaviorTreeTools, HandleListBTGraphNodes);
+	MCP_REGISTER_TOOL(MCPBehaviorTreeTools, HandleAddBTGraphNode);
+	MCP_REGISTER_TOOL(MCPBehaviorTreeTools, HandleConnectBTGraphNodes);
+
+	// UMG
+	MCP_REGISTER_TOOL(MCPUMGTools, HandleCreateUMGWidgetBlueprint);
+	MCP_REGISTER_TOOL(MCPUMGTools, HandleAddWidgetToViewport);
+	MCP_REGISTER_TOOL(MCPUMGTools, HandleBindWidgetEvent);
+	MCP_REGISTER_TOOL(MCPUMGTools, HandleClearWidgetTree);
+	MCP_REGISTER_TOOL(MCPUMGTools, HandleAddWidget);
+	MCP_REGISTER_TOOL(MCPUMGTools, HandleRemoveWidget);
+	MCP_REGISTER_TOOL(MCPUMGTools, HandleGetWidgetTree);
+
+	// Slate
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleGetAllWindows);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleGetWidgetTree);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleGetWidgetUnderCursor);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleFindWidgetsByType);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleClickAtPosition);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleSendTextInput);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleSendKeyPress);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleGetWidgetAtPosition);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleGetActiveWindow);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleMoveWindow);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleResizeWindow);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleCloseWindow);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleCloseDockTab);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleGetFocusedWidget);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleSetKeyboardFocus);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleInvokeTab);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleGetAllDockTabs);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleScrollAtPosition);
+	MCP_REGISTER_TOOL(MCPSlateTools, HandleShowNotification);
+
+	UE_LOG(LogRemoteMCP, Log, TEXT("FMCPToolRegistry: %d native tools registered"), Tools.Num());
+}
+
+#undef MCP_REGISTER_TOOL
+
+void FMCPToolRegistry::RegisterTool(const FString& Name, FMCPToolHandler Handler, bool bThreadSafe)
+{
+	if (!Handler)
+	{
+		return;
+	}
+	const FName Key = MakeToolKey(Name);
+	if (Tools.Contains(Key))
+	{
+		UE_LOG(LogRemoteMCP, Warning, TEXT("FMCPToolRegistry: tool '%s' registered twice, the last one wins"), *Name);
+	}
+	Tools.Add(Key, FToolEntry{ Name, MoveTemp(Handler), bThreadSafe });
+}
+
+void FMCPToolRegistry::UnregisterTool(const FString& Name)
+{
+	Tools.Remove(MakeToolKey(Name));
+}
+
+void FMCPToolRegistry::Reset()
+{
+	Tools.Empty();
+}
+
+bool FMCPToolRegistry::HasTool(const FString& Name) const
+{
+	return Tools.Contains(MakeToolKey(Name));
+}
+
+const FMCPToolHandler* FMCPToolRegistry::FindTool(const FString& Name) const
+{
+	const FToolEntry* Entry = Tools.Find(MakeToolKey(Name));
+	return Entry ? &Entry->Handler : nullptr;
+}
+
+bool FMCPToolRegistry::IsToolThreadSafe(const FString& Name) const
+{
+	const FToolEntry* Entry = Tools.Find(MakeToolKey(Name));
+	return Entry && Entry->bThreadSafe;
+}
+
+TArray<FString> FMCPToolRegistry::GetToolNames() const
+{
+	TArray<FString> Names;
+	Names.Reserve(Tools.Num());
+	for (const TPair<FName, FToolEntry>& Pair : Tools)
+	{
+		Names.Add(Pair.Value.Name);
+	}
+	Names.Sort();
+	return Names;
+}
+
+FJsonObjectParameter FMCPToolRegistry::CallTool(const FString& Name, const FJsonObjectParameter& Params) const
+{
+	const FMCPToolHandler* Handler = FindTool(Name);
+	if (!Handler)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown tool '%s'"), *Name));
+	}
+	return (*Handler)(Params);
+}
+
+FJsonObjectParameter FMCPToolRegistry::CallBatch(const FJsonObjectParameter& Params) const
+{
+	const TArray<TSharedPtr<FJsonValue>>* Steps = nullptr;
+	if (!Params->TryGetArrayField(TEXT("steps"), Steps))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'steps' parameter"));
+	}
+
+	bool bStopOnError = true;
+	Params->TryGetBoolField(TEXT("stop_on_error"), bStopOnError);
+	bool bTransaction = true;
+	Params->TryGetBoolField(TEXT("transaction"), bTransaction);
+	FString TransactionName = TEXT("MCP Batch");
+	Params->TryGetStringField(TEXT("transaction_name"), TransactionName);
+
+	FScopedTransaction Transaction(FText::FromString(TransactionName), bTransaction);
+
+	TArray<TSharedPtr<FJsonObject>> StepResults;
+	StepResults.SetNum(Steps->Num());
+	TMap<FString, int32> StepIds;
+	TArray<TSharedPtr<FJsonValue>> ResultArray;
+	int32 Completed = 0;
+	bool bAllSucceeded = true;
+
+	for (int32 StepIndex = 0; StepIndex < Steps->Num(); ++StepIndex)
+	{
+		TSharedPtr<FJsonObject> StepResult = MakeShared<FJsonObject>();
+		StepResult->SetNumberField(TEXT("index"), StepIndex);
+
+		const TSharedPtr<FJsonObject>* StepObject = nullptr;
+		FString ToolName;
+		FString StepId;
+		FString Error;
+		TSharedPtr<FJsonObject> Arguments = MakeShared<FJsonObject>();
+
+		if (!(*Steps)[StepIndex]->TryGetObject(StepObject) || !(*StepObject)->TryGetStringField(TEXT("tool"), ToolName))
+		{
+			Error = TEXT("Step must be an object with a 'tool' field");
+		}
+		else
+		{
+			StepResult->SetStringField(TEXT("tool"), ToolName);
+			if ((*StepObject)->TryGetStringField(TEXT("id"), StepId))
+			{
+				StepResult->SetStringField(TEXT("id"), StepId);
+			}
+
+			const TSharedPtr<FJsonObject>* RawArguments = nullptr;
+			if ((*StepObject)->TryGetObjectField(TEXT("arguments"), RawArguments))
+			{
+				TSharedPtr<FJsonValue> Substituted = SubstituteBatchRefs(MakeShared<FJsonValueObject>(*RawArguments), StepResults, StepIds, Error);
+				if (Error.IsEmpty())
+				{
+					Arguments = Substituted->AsObject();
+				}
+			}
+		}
+
+		if (Error.IsEmpty())
+		{
+			const FMCPToolHandler* Handler = FindTool(ToolName);
+			if (!Handler)
+			{
+				Error = FString::Printf(TEXT("Unknown tool '%s'"), *ToolName);
+			}
+			else
+			{
+				FJsonObjectParameter Result = (*Handler)(FJsonObjectParameter(Arguments));
+				const TSharedPtr<FJsonObject>& ResultObject = Result.GetJsonObject();
+				StepResults[StepIndex] = ResultObject;
+
+				bool bStepSucceeded = true;
+				if (ResultObject.IsValid() && ResultObject->TryGetBoolField(TEXT("success"), bStepSucceeded) && !bStepSucceeded)
+				{
+					ResultObject->TryGetStringField(TEXT("error"), Error);
+					if (Error.IsEmpty())
+					{
+						Error = TEXT("Tool reported failure");
+					}
+				}
+				StepResult->SetObjectField(TEXT("result"), ResultObject);
+			}
+		}
+
+		if (!StepId.IsEmpty())
+		{
+			StepIds.Add(StepId, StepIndex);
+		}
+
+		StepResult->SetBoolField(TEXT("success"), Error.IsEmpty());
+		if (!Error.IsEmpty())
+		{
+			StepResult->SetStringField(TEXT("error"), Error);
+			bAllSucceeded = false;
+		}
+		ResultArray.Add(MakeShared<FJsonValueObject>(StepResult));
+		++Completed;
+
+		if (!Error.IsEmpty() && bStopOnError)
+		{
+			break;
+		}
+	}
+
+	FJsonObjectParameter Response = MakeShared<FJsonObject>();
+	Response->SetBoolField(TEXT("success"), bAllSucceeded);
+	Response->SetNumberField(TEXT("completed"), Completed);
+	Response->SetNumberField(TEXT("total"), Steps->Num());
+	Response->SetArrayField(TEXT("results"), ResultArray);
+	return Response;
+}
+
+FJsonObjectParameter FMCPToolRegistry::MakeGameThreadRequiredResponse()
+{
+	TSharedPtr<FJsonObject> Response = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Requires the game thread"));
+	Response->SetBoolField(GameThreadRequiredField, true);
+	return Response;
+}
+
+bool FMCPToolRegistry::IsGameThreadRequired(const FJsonObjectParameter& Result)
+{
+	// Streamed responses are never the game-thread marker; don't parse them just to find out.
+	bool bRequired = false;
+	return Result.HasJsonObject() && Result->TryGetBoolField(GameThreadRequiredField, bRequired) && bRequired;
+}
+
+FName FMCPToolRegistry::MakeToolKey(const FString& Name)
+{
+	FString Key = Name.TrimStartAndEnd();
+	Key.ReplaceInline(TEXT("_"), TEXT(""));
+	return FName(*Key);
+}
@@ -0,0 +1,208 @@
+#include "MCPTools/MCPToolScheduler.h"
+
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "MCPSetting.h"
+#include "MCPSubsystem.h"
+#include "MCPUtility.h"
+#include "MCPTools/MCPToolRegistry.h"
+#include "Tasks/Task.h"
+
+namespace MCPToolScheduler
+{
+	// a poller collects its result within milliseconds; anything older was abandoned by its caller
+	static constexpr double ResultLifetimeSeconds = 300.0;
+	static constexpr double PruneIntervalSeconds = 30.0;
+	static constexpr int32 MaxResults = 256;
+
+	static double GetBudgetSeconds()
+	{
+		const UMCPSubsystem* Subsystem = UMCPSubsystem::Get();
+		const float BudgetMs = Subsystem ? Subsystem->GetTaskBudgetMs() : GetDefault<UMCPSetting>()->TaskBudgetMs;
+		return BudgetMs / 1000.0;
+	}
+}
+
+FMCPToolScheduler& FMCPToolScheduler::Get()
+{
+	static FMCPToolScheduler Scheduler;
+	return Scheduler;
+}
+
+void FMCPToolScheduler::Initialize()
+{
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMCPToolScheduler::Tick));
+}
+
+void FMCPToolScheduler::Shutdown()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	Reset();
+}
+
+int64 FMCPToolScheduler::Submit(const FString& Name, const FString& Parameter)
+{
+	const int64 RequestId = NextRequestId.fetch_add(1);
+
+	FJsonObjectParameter Params{};
+	Params.JsonObjectFromString(Parameter);
+	const EMCPJsonFormat Format = UMCPUtility::TakeResponseFormat(Params);
+
+	if (!FMCPToolRegistry::Get().IsToolThreadSafe(Name))
+	{
+		RunOnGameThread(RequestId, Name, Params, Format);
+		return RequestId;
+	}
+
+	FScopeLock Lock(&PendingLock);
+	PendingReads.Add(FCall{ RequestId, Name, Params, Format });
+	return RequestId;
+}
+
+bool FMCPToolScheduler::TryTakeResult(int64 RequestId, FString& OutResult)
+{
+	FScopeLock Lock(&ResultsLock);
+	FResult Result;
+	if (!Results.RemoveAndCopyValue(RequestId, Result))
+	{
+		return false;
+	}
+	OutResult = MoveTemp(Result.Json);
+	return true;
+}
+
+void FMCPToolScheduler::Reset()
+{
+	{
+		FScopeLock Lock(&PendingLock);
+		PendingReads.Empty();
+	}
+	FScopeLock Lock(&ResultsLock);
+	Results.Empty();
+}
+
+bool FMCPToolScheduler::Tick(float DeltaTime)
+{
+	TArray<FCall> Calls;
+	{
+		FScopeLock Lock(&PendingLock);
+		Calls = MoveTemp(PendingReads);
+	}
+	if (!Calls.IsEmpty())
+	{
+		const int32 Ran = RunReadWindow(Calls);
+		if (Ran < Calls.Num())
+		{
+			// out of budget: the rest go first next frame
+			FScopeLock Lock(&PendingLock);
+			PendingReads.Insert(Calls.GetData() + Ran, Calls.Num() - Ran, 0);
+		}
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	FScopeLock Lock(&ResultsLock);
+	if (Now - LastPruneTime > MCPToolScheduler::PruneIntervalSeconds)
+	{
+		PruneResults(Now);
+	}
+	return true;
+}
+
+int32 FMCPToolScheduler::RunReadWindow(const TArray<FCall>& Calls)
+{
+	// The game thread blocks here until every started call is done: nothing edits the objects they walk and GC cannot
+	// run, while the calls themselves run in parallel on the task pool. Workers take calls in order and stop taking
+	// new ones at the deadline (the first call always runs); a running call cannot be cut short, so a window overruns
+	// the budget by at most the calls in flight.
+	const double Deadline = FPlatformTime::Seconds() + MCPToolScheduler::GetBudgetSeconds();
+	const int32 NumWorkers = FMath::Clamp(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1, Calls.Num());
+
+	TArray<FJsonObjectParameter> CallResults;
+	CallResults.SetNum(Calls.Num());
+	std::atomic<int32> NextCall{ 0 };
+	std::atomic<int32> Remaining{ NumWorkers };
+	FEventRef Done(EEventMode::ManualReset);
+
+	for (int32 Worker = 0; Worker < NumWorkers; ++Worker)
+	{
+		UE::Tasks::Launch(UE_SOURCE_LOCATION, [&Calls, &CallResults, &NextCall, &Remaining, &Done, Deadline]()
+		{
+			while (NextCall.load() == 0 || FPlatformTime::Seconds() < Deadline)
+			{
+				const int32 Index = NextCall.fetch_add(1);
+				if (Index >= Calls.Num())
+				{
+					break;
+				}
+				CallResults[Index] = FMCPToolRegistry::Get().CallTool(Calls[Index].Name, Calls[Index].Params);
+			}
+			if (Remaining.fetch_sub(1) == 1)
+			{
+				Done->Trigger();
+			}
+		});
+	}
+	// waiting on the tasks themselves could run them inline here, i.e. on the game thread, where handlers may load
+	Done->Wait();
+
+	// every index handed out was run to completion
+	const int32 Ran = FMath::Min(NextCall.load(), Calls.Num());
+	for (int32 Index = 0; Index < Ran; ++Index)
+	{
+		const FCall& Call = Calls[Index];
+		if (FMCPToolRegistry::IsGameThreadRequired(CallResults[Index]))
+		{
+			Complete(Call.RequestId, FMCPToolRegistry::Get().CallTool(Call.Name, Call.Params), Call.Format);
+		}
+		else
+		{
+			Complete(Call.RequestId, CallResults[Index], Call.Format);
+		}
+	}
+	return Ran;
+}
+
+void FMCPToolScheduler::RunOnGameThread(int64 RequestId, const FString& Name, const FJsonObjectParameter& Params, EMCPJsonFormat Format)
+{
+	AsyncTask(ENamedThreads::GameThread, [this, RequestId, Name, Params, Format]()
+	{
+		Complete(RequestId, FMCPToolRegistry::Get().CallTool(Name, Params), Format);
+	});
+}
+
+void FMCPToolScheduler::Complete(int64 RequestId, const FJsonObjectParameter& Result, EMCPJsonFormat Format)
+{
+	FResult Entry;
+	Entry.Json = UMCPUtility::FormatResponse(Result, Format);
+	Entry.CompletedTime = FPlatformTime::Seconds();
+
+	FScopeLock Lock(&ResultsLock);
+	Results.Add(RequestId, MoveTemp(Entry));
+	if (Results.Num() > MCPToolScheduler::MaxResults)
+	{
+		PruneResults(FPlatformTime::Seconds());
+	}
+}
+
+void FMCPToolScheduler::PruneResults(double Now)
+{
+	LastPruneTime = Now;
+	for (auto It = Results.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value().CompletedTime > MCPToolScheduler::ResultLifetimeSeconds)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// still over the cap: the oldest uncollected results go first
+	if (Results.Num() > MCPToolScheduler::MaxResults)
+	{
+		Results.ValueSort([](const FResult& A, const FResult& B) { return A.CompletedTime < B.CompletedTime; });
+		int32 Excess = Results.Num() - MCPToolScheduler::MaxResults;
+		for (auto It = Results.CreateIterator(); It && Excess > 0; ++It, --Excess)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -2,6 +2,9 @@
 
 
 #include "MCPTools/MCPUMGTools.h"
+#include "MCPTools/MCPBlueprintResolver.h"
+#include "MCPTools/MCPPropertyPath.h"
+#include "MCPTools/MCPSymbolIndex.h"
 #include "MCPTools/UnrealMCPCommonUtils.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
@@ -16,24 +19,9 @@
 #include "Kismet2/KismetEditorUtilities.h"
 #include "K2Node_Event.h"
 
-static UWidgetBlueprint* FindWidgetBlueprintByName(const FString& Name)
+static UWidgetBlueprint* FindWidgetBlueprintByName(const FString& Name, FString& OutError)
 {
-	if (Name.StartsWith(TEXT("/")))
-	{
-		return Cast<UWidgetBlueprint>(UEditorAssetLibrary::LoadAsset(Name));
-	}
-
-	FAssetRegistryModule& ARM = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	TArray<FAssetData> Assets;
-	ARM.Get().GetAssetsByClass(UWidgetBlueprint::StaticClass()->GetClassPathName(), Assets);
-	for (const FAssetData& Asset : Assets)
-	{
-		if (Asset.AssetName.ToString() == Name)
-		{
-			return Cast<UWidgetBlueprint>(Asset.GetAsset());
-		}
-	}
-	return nullptr;
+	return Cast<UWidgetBlueprint>(FMCPBlueprintResolver::Get().Resolve(Name, OutError, UWidgetBlueprint::StaticClass()));
 }
 
 
@@ -119,10 +107,11 @@ FJsonObjectParameter UMCPUMGTools::HandleAddWidgetToViewport(const FJsonObjectPa
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
 	}
 
-	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprintByName(BlueprintName);
+	FString BlueprintError;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprintByName(BlueprintName, BlueprintError);
 	if (!WidgetBlueprint)
 	{
-		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Widget Blueprint '%s' not found"), *BlueprintName));
+		return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
 	}
 
 	// Get optional Z-order parameter
@@ -175,10 +164,11 @@ FJsonObjectParameter UMCPUMGTools::HandleBindWidgetEvent(const FJsonObjectParame
 		return Response;
 	}
 
-	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprintByName(BlueprintName);
+	FString BlueprintError;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprintByName(BlueprintName, BlueprintError);
 	if (!WidgetBlueprint)
 	{
-		Response->SetStringField(TEXT("error"), FString::Printf(TEXT("Widget Blueprint '%s' not found"), *BlueprintName));
+		Response->SetStringField(TEXT("error"), BlueprintError);
 		return Response;
 	}
 
@@ -275,10 +265,11 @@ FJsonObjectParameter UMCPUMGTools::HandleClearWidgetTree(const FJsonObjectParame
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
 	}
 
-	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprintByName(BlueprintName);
+	FString BlueprintError;
+	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprintByName(BlueprintName, BlueprintError);
 	if (!WidgetBlueprint)
 	{
-		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Widget Blueprint '%s' not found"), *BlueprintName));
+		return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
 	}
 
 	UWidgetTree* WidgetTree = WidgetBlueprint->WidgetTree;
@@ -298,72 +289,16 @@ FJsonObjectParameter UMCPUMGTools::HandleClearWidgetTree(const FJsonObjectParame
 
 // ===== Generic Widget Helpers =====
 
-static UClass* FindWidgetClassByName(const FString& TypeName)
+static UClass* FindWidgetClassByName(const FString& TypeName, FString& OutError)
 {
-	FString SearchName = TypeName;
-	if (SearchName.Len() > 1 && SearchName.StartsWith(TEXT("U")) && FChar::IsUpper(SearchName[1]))
-	{
-		SearchName.RightChopInline(1);
-	}
-
-	UClass* Found = FindFirstObject<UClass>(*SearchName, EFindFirstObjectOptions::NativeFirst, ELogVerbosity::NoLogging);
-	if (Found && Found->IsChildOf(UWidget::StaticClass()))
-	{
-		return Found;
-	}
-
-	Found = StaticLoadClass(UWidget::StaticClass(), nullptr, *TypeName);
-	if (Found)
-	{
-		return Found;
-	}
-
-	for (TObjectIterator<UClass> It; It; ++It)
-	{
-		if (It->IsChildOf(UWidget::StaticClass()) && It->GetName() == SearchName)
-		{
-			return *It;
-		}
-	}
-
-	return nullptr;
+	return FMCPSymbolIndex::Get().FindClass(TypeName, UWidget::StaticClass(), OutError);
 }
 
 static bool SetPropertyFromJsonValue(UObject* Obj, const FString& PropName, const TSharedPtr<FJsonValue>& JsonVal)
 {
-	FProperty* Prop = Obj->GetClass()->FindPropertyByName(*PropName);
-	if (!Prop)
-	{
-		return false;
-	}
-
-	void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(Obj);
-
-	if (CastField<FTextProperty>(Prop))
-	{
-		CastField<FTextProperty>(Prop)->SetPropertyValue(ValuePtr, FText::FromString(JsonVal->AsString()));
-		return true;
-	}
-
-	FString Str;
-	if (JsonVal->Type == EJson::String)
-	{
-		Str = JsonVal->AsString();
-	}
-	else if (JsonVal->Type == EJson::Number)
-	{
-		Str = FString::SanitizeFloat(JsonVal->AsNumber());
-	}
-	else if (JsonVal->Type == EJson::Boolean)
-	{
-		Str = JsonVal->AsBool() ? TEXT("True") : TEXT("False");
-	}
-	else
-	{
-		return false;
-	}
-
-	return Prop->ImportText_Direct(*Str, ValuePtr, Obj, 0) != nullptr;
+	FString Error;
+	const FMCPPropertyPath* Path = FMCPPropertyPathCache::Get().Find(Obj->GetClass(), PropName, Error);
+	return Path && Path->SetValue(Obj, JsonVal, Error);
 }
 
 static TSharedPtr<FJsonObject> BuildWidgetTreeJson(UWidget* Widget)
@@ -454,16 +389,18 @@ FJsonObjectParameter UMCPUMGTools::HandleAddWidget(const FJsonObjectParameter& P
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'widget_name'"));
 	}
 
-	UWidgetBlueprint* WB = FindWidgetBlueprintByName(BlueprintName);
+	FString BlueprintError;
+	UWidgetBlueprint* WB = FindWidgetBlueprintByName(BlueprintName, BlueprintError);
 	if (!WB)
 	{
-		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint '%s' not found"), *BlueprintName));
+		return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
 	}
 
-	UClass* WidgetClass = FindWidgetClassByName(WidgetType);
+	FString ClassError;
+	UClass* WidgetClass = FindWidgetClassByName(WidgetType, ClassError);
 	if (!WidgetClass)
 	{
-		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Widget class '%s' not found"), *WidgetType));
+		return FUnrealMCPCommonUtils::CreateErrorResponse(ClassError);
 	}
 
 	if (!WB->WidgetTree->RootWidget)
@@ -556,11 +493,11 @@ FJsonObjectParameter UMCPUMGTools::HandleRemoveWidget(const FJsonObjectParameter
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'widget_name'"));
 	}
 
-	UWidgetBlueprint* WB = FindWidgetBlueprintByName(BlueprintName);
+	FString BlueprintError;
+	UWidgetBlueprint* WB = FindWidgetBlueprintByName(BlueprintName, BlueprintError);
 	if (!WB)
 	{
-		return FUnrealMCPCommonUtils::CreateErrorResponse(
-			FString::Printf(TEXT("Blueprint '%s' not found"), *BlueprintName));
+		return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
 	}
 
 	UWidget* Widget = WB->WidgetTree->FindWidget(*WidgetName);
@@ -599,11 +536,11 @@ FJsonObjectParameter UMCPUMGTools::HandleGetWidgetTree(const FJsonObjectParamete
 		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name'"));
 	}
 
-	UWidgetBlueprint* WB = FindWidgetBlueprintByName(BlueprintName);
+	FString BlueprintError;
+	UWidgetBlueprint* WB = FindWidgetBlueprintByName(BlueprintName, BlueprintError);
 	if (!WB)
 	{
-		return FUnrealMCPCommonUtils::CreateErrorResponse(
-			FString::Printf(TEXT("Blueprint '%s' not found"), *BlueprintName));
+		return FUnrealMCPCommonUtils::CreateErrorResponse(BlueprintError);
 	}
 
 	FJsonObjectParameter Result = MakeShared<FJsonObject>();
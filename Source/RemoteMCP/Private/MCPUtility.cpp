@@ -14,6 +14,133 @@ bool UStructToJsonObjectStringInternal(const TSharedRef<FJsonObject>& JsonObject
 	return bSuccess;
 }
 
+namespace
+{
+	// Short forms for the keys that dominate large listings. Values must stay unique.
+	const TMap<FString, FString>& GetKeyAbbreviations()
+	{
+		static const TMap<FString, FString> Abbreviations = {
+			{ TEXT("name"), TEXT("n") },
+			{ TEXT("class"), TEXT("c") },
+			{ TEXT("type"), TEXT("t") },
+			{ TEXT("path"), TEXT("p") },
+			{ TEXT("guid"), TEXT("g") },
+			{ TEXT("location"), TEXT("loc") },
+			{ TEXT("rotation"), TEXT("rot") },
+			{ TEXT("scale"), TEXT("scl") },
+			{ TEXT("children"), TEXT("ch") },
+			{ TEXT("visibility"), TEXT("vis") },
+			{ TEXT("title"), TEXT("ti") },
+			{ TEXT("pins"), TEXT("ps") },
+			{ TEXT("pin"), TEXT("pi") },
+			{ TEXT("pin_name"), TEXT("pn") },
+			{ TEXT("node_guid"), TEXT("ng") },
+			{ TEXT("node_name"), TEXT("nn") },
+			{ TEXT("direction"), TEXT("d") },
+			{ TEXT("default_value"), TEXT("dv") },
+			{ TEXT("linked_to"), TEXT("lt") },
+			{ TEXT("linked_to_count"), TEXT("ltc") },
+			{ TEXT("is_array"), TEXT("ia") },
+			{ TEXT("is_set"), TEXT("is") },
+			{ TEXT("is_map"), TEXT("im") },
+			{ TEXT("is_reference"), TEXT("ir") },
+			{ TEXT("is_const"), TEXT("ic") },
+			{ TEXT("pos_x"), TEXT("x") },
+			{ TEXT("pos_y"), TEXT("y") },
+			{ TEXT("properties"), TEXT("pr") },
+		};
+		return Abbreviations;
+	}
+
+	bool IsEmptyJsonValue(const TSharedPtr<FJsonValue>& Value)
+	{
+		if (!Value.IsValid())
+		{
+			return true;
+		}
+		switch (Value->Type)
+		{
+		case EJson::None:
+		case EJson::Null:
+			return true;
+		case EJson::String:
+			return Value->AsString().IsEmpty();
+		case EJson::Array:
+			return Value->AsArray().IsEmpty();
+		case EJson::Object:
+			return !Value->AsObject().IsValid() || Value->AsObject()->Values.IsEmpty();
+		default:
+			return false;
+		}
+	}
+
+	TSharedPtr<FJsonValue> AbbreviateValue(const TSharedPtr<FJsonValue>& Value, TSet<FString>& UsedKeys);
+
+	TSharedRef<FJsonObject> AbbreviateObject(const FJsonObject& Source, TSet<FString>& UsedKeys)
+	{
+		const TMap<FString, FString>& Abbreviations = GetKeyAbbreviations();
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Source.Values)
+		{
+			TSharedPtr<FJsonValue> Value = AbbreviateValue(Pair.Value, UsedKeys);
+			if (IsEmptyJsonValue(Value))
+			{
+				continue;
+			}
+			const FString* Short = Abbreviations.Find(Pair.Key);
+			// keep the long key if the short one would collide with a real key of the same object
+			if (Short && !Source.Values.Contains(*Short))
+			{
+				UsedKeys.Add(Pair.Key);
+				Result->SetField(*Short, Value);
+			}
+			else
+			{
+				Result->SetField(Pair.Key, Value);
+			}
+		}
+		return Result;
+	}
+
+	TSharedPtr<FJsonValue> AbbreviateValue(const TSharedPtr<FJsonValue>& Value, TSet<FString>& UsedKeys)
+	{
+		if (!Value.IsValid())
+		{
+			return Value;
+		}
+		if (Value->Type == EJson::Object && Value->AsObject().IsValid())
+		{
+			return MakeShared<FJsonValueObject>(AbbreviateObject(*Value->AsObject(), UsedKeys));
+		}
+		if (Value->Type == EJson::Array)
+		{
+			TArray<TSharedPtr<FJsonValue>> Items;
+			Items.Reserve(Value->AsArray().Num());
+			for (const TSharedPtr<FJsonValue>& Item : Value->AsArray())
+			{
+				Items.Add(AbbreviateValue(Item, UsedKeys));
+			}
+			return MakeShared<FJsonValueArray>(Items);
+		}
+		return Value;
+	}
+
+	TSharedRef<FJsonObject> MakeAbbreviatedObject(const TSharedRef<FJsonObject>& JsonObject)
+	{
+		TSet<FString> UsedKeys;
+		TSharedRef<FJsonObject> Result = AbbreviateObject(*JsonObject, UsedKeys);
+		if (UsedKeys.Num() > 0)
+		{
+			TSharedPtr<FJsonObject> Legend = MakeShared<FJsonObject>();
+			for (const FString& Key : UsedKeys)
+			{
+				Legend->SetStringField(GetKeyAbbreviations().FindChecked(Key), Key);
+			}
+			Result->SetObjectField(TEXT("_keys"), Legend);
+		}
+		return Result;
+	}
+}
 
 TSharedRef<FJsonObject> UMCPUtility::ConvertStringToJsonObject(const FString& JsonString)
 {
@@ -23,9 +150,59 @@ TSharedRef<FJsonObject> UMCPUtility::ConvertStringToJsonObject(const FString& Js
 	return JsonObject.ToSharedRef();
 }
 
-FString UMCPUtility::ConvertJsonObjectToString(const TSharedRef<FJsonObject>& JsonObject)
+FString UMCPUtility::ConvertJsonObjectToString(const TSharedRef<FJsonObject>& JsonObject, EMCPJsonFormat Format)
 {
 	FString Ret;
-	UStructToJsonObjectStringInternal<TCHAR,TPrettyJsonPrintPolicy<TCHAR>>(JsonObject, Ret, 0);
+	switch (Format)
+	{
+	case EMCPJsonFormat::Pretty:
+		UStructToJsonObjectStringInternal<TCHAR,TPrettyJsonPrintPolicy<TCHAR>>(JsonObject, Ret, 0);
+		break;
+	case EMCPJsonFormat::Abbreviated:
+		UStructToJsonObjectStringInternal<TCHAR,TCondensedJsonPrintPolicy<TCHAR>>(MakeAbbreviatedObject(JsonObject), Ret, 0);
+		break;
+	default:
+		UStructToJsonObjectStringInternal<TCHAR,TCondensedJsonPrintPolicy<TCHAR>>(JsonObject, Ret, 0);
+		break;
+	}
 	return Ret;
-}
\ No newline at end of file
+}
+
+FString UMCPUtility::FormatResponse(const FJsonObjectParameter& Result, EMCPJsonFormat Format)
+{
+	if (Format == EMCPJsonFormat::Compact)
+	{
+		return Result.ConvertToString();
+	}
+	const TSharedPtr<FJsonObject>& JsonObject = Result.GetJsonObject();
+	if (!JsonObject.IsValid())
+	{
+		return Result.ConvertToString();
+	}
+	return ConvertJsonObjectToString(JsonObject.ToSharedRef(), Format);
+}
+
+EMCPJsonFormat UMCPUtility::TakeResponseFormat(FJsonObjectParameter& Params)
+{
+	// the bridge answers python, which reads the keys; UMCPSetting::ResponseFormat is applied at the MCP output instead
+	EMCPJsonFormat Format = EMCPJsonFormat::Compact;
+	const TSharedPtr<FJsonObject>& JsonObject = Params.GetJsonObject();
+	FString FormatName;
+	if (JsonObject.IsValid() && JsonObject->TryGetStringField(TEXT("response_format"), FormatName))
+	{
+		JsonObject->RemoveField(TEXT("response_format"));
+		if (FormatName.Equals(TEXT("pretty"), ESearchCase::IgnoreCase))
+		{
+			Format = EMCPJsonFormat::Pretty;
+		}
+		else if (FormatName.Equals(TEXT("abbreviated"), ESearchCase::IgnoreCase))
+		{
+			Format = EMCPJsonFormat::Abbreviated;
+		}
+		else if (FormatName.Equals(TEXT("compact"), ESearchCase::IgnoreCase))
+		{
+			Format = EMCPJsonFormat::Compact;
+		}
+	}
+	return Format;
+}
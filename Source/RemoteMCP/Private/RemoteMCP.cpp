@@ -14,6 +14,15 @@
 #include "MCPMisc.h"
 #include "MCPSetting.h"
 #include "MCPTools/LogCapture.h"
+#include "MCPTools/MCPActorIndex.h"
+#include "MCPTools/MCPBlueprintResolver.h"
+#include "MCPTools/MCPChangeJournal.h"
+#include "MCPTools/MCPGraphIndex.h"
+#include "MCPTools/MCPPropertyPath.h"
+#include "MCPTools/MCPSpatialIndex.h"
+#include "MCPTools/MCPSymbolIndex.h"
+#include "MCPTools/MCPToolRegistry.h"
+#include "MCPTools/MCPToolScheduler.h"
 
 class UEditorUtilitySubsystem;
 class UEditorUtilityWidget;
@@ -89,6 +98,12 @@ namespace MCPCommand
 					case EMCPServerState::Stop:
 						UE_LOG(LogRemoteMCP, Log, TEXT("RemoteMCP Stopped"));
 						break;
+					case EMCPServerState::Starting:
+						UE_LOG(LogRemoteMCP, Log, TEXT("RemoteMCP Starting"));
+						break;
+					case EMCPServerState::Stopping:
+						UE_LOG(LogRemoteMCP, Log, TEXT("RemoteMCP Stopping"));
+						break;
 					default:
 						break;
 					}
@@ -123,6 +138,15 @@ namespace MCPCommand
 
 void FRemoteMCPModule::StartupModule()
 {
+	FMCPToolRegistry::Get().RegisterBuiltinTools();
+	FMCPActorIndex::Get().Initialize();
+	FMCPSpatialIndex::Get().Initialize();
+	FMCPChangeJournal::Get().Initialize();
+	FMCPPropertyPathCache::Get().Initialize();
+	FMCPBlueprintResolver::Get().Initialize();
+	FMCPSymbolIndex::Get().Initialize();
+	FMCPToolScheduler::Get().Initialize();
+
 	if (GetDefault<UMCPSetting>()->bEnable)
 	{
 		MCPRuntime = TStrongObjectPtr<UMCPSubsystem>(NewObject<UMCPSubsystem>());
@@ -160,6 +184,16 @@ void FRemoteMCPModule::ShutdownModule()
 		MCPRuntime.Reset();
 	}
 
+	FMCPToolScheduler::Get().Shutdown();
+	FMCPGraphIndex::Get().Shutdown();
+	FMCPSymbolIndex::Get().Shutdown();
+	FMCPBlueprintResolver::Get().Shutdown();
+	FMCPPropertyPathCache::Get().Shutdown();
+	FMCPChangeJournal::Get().Shutdown();
+	FMCPSpatialIndex::Get().Shutdown();
+	FMCPActorIndex::Get().Shutdown();
+	FMCPToolRegistry::Get().Reset();
+
 	UToolMenus::UnRegisterStartupCallback(this);
 
 	UToolMenus::UnregisterOwner(this);
@@ -3,6 +3,9 @@
 
 #include "Structure/JsonParameter.h"
 
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(JsonParameter)
 // Sets default values
 FJsonObject FJsonObjectParameter::EmptyDefaultObject{};
@@ -53,16 +56,16 @@ bool FJsonObjectParameter::ImportTextItem(const TCHAR*& Buffer, int32 PortFlags,
 		}
 		return false;
 	}
-	JsonString = Json;
+	JsonString = MoveTemp(Json);
 	return true;
 }
 
 bool FJsonObjectParameter::ExportTextItem(FString& ValueStr, FJsonObjectParameter const& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const
 {
-	// empty pointer yields empty string
+	// serialized-only (or empty) parameter: the string is all there is
 	if (!JsonObject.IsValid())
 	{
-		ValueStr.Empty();
+		ValueStr = JsonString;
 		return true;
 	}
 
@@ -70,12 +73,27 @@ bool FJsonObjectParameter::ExportTextItem(FString& ValueStr, FJsonObjectParamete
 	return JsonObjectToString(ValueStr);
 }
 
+bool FJsonObjectParameter::Serialize(FArchive& Ar)
+{
+	if (Ar.IsSaving())
+	{
+		MaterializeJsonString();
+	}
+	// fall through to the default tagged property serialization of JsonString
+	return false;
+}
+
 void FJsonObjectParameter::PostSerialize(const FArchive& Ar)
 {
-	if (!JsonString.IsEmpty())
+	if (Ar.IsLoading() && !JsonString.IsEmpty())
 	{
 		// try to parse JsonString
-		if (!JsonObjectFromString(JsonString))
+		const FString Source = JsonString;
+		if (JsonObjectFromString(Source))
+		{
+			JsonString = Source;
+		}
+		else
 		{
 			// do not abide a string that won't parse
 			JsonString.Empty();
@@ -83,8 +101,38 @@ void FJsonObjectParameter::PostSerialize(const FArchive& Ar)
 	}
 }
 
+const FString& FJsonObjectParameter::MaterializeJsonString()
+{
+	// the object may have been changed through any copy sharing it, so it is encoded every time
+	if (JsonObject.IsValid())
+	{
+		JsonString.Reset();
+		JsonObjectToString(JsonString);
+	}
+	return JsonString;
+}
+
+FJsonObjectParameter FJsonObjectParameter::FromSerializedString(FString&& Json)
+{
+	FJsonObjectParameter Result;
+	Result.JsonObject.Reset();
+	Result.JsonString = MoveTemp(Json);
+	return Result;
+}
+
+void FJsonObjectParameter::EnsureJsonObject() const
+{
+	if (JsonObject.IsValid() || JsonString.IsEmpty())
+	{
+		return;
+	}
+	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
+	FJsonSerializer::Deserialize(JsonReader, JsonObject);
+}
+
 FJsonObjectParameter::operator bool() const
 {
+	EnsureJsonObject();
 	return JsonObject.IsValid() && !JsonObject->Values.IsEmpty();
 }
 
@@ -96,8 +144,37 @@ bool FJsonObjectParameter::JsonObjectToString(FString& Str) const
 
 bool FJsonObjectParameter::JsonObjectFromString(const FString& Str)
 {
+	// the source string is not kept; it is re-encoded on demand only if someone asks for it
 	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Str);
-	JsonString = Str;
+	JsonString.Empty();
+	return FJsonSerializer::Deserialize(JsonReader, JsonObject);
+}
+
+bool FJsonObjectParameter::JsonObjectToUtf8(TArray<uint8>& OutBytes) const
+{
+	OutBytes.Reset();
+	if (!JsonObject.IsValid())
+	{
+		// already serialized (e.g. a streamed response): one direct TCHAR -> UTF-8 pass
+		FTCHARToUTF8 Converted(*JsonString, JsonString.Len());
+		OutBytes.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+		return true;
+	}
+	FMemoryWriter Archive(OutBytes);
+	TSharedRef<TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>> JsonWriter = TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&Archive, 0);
+	return FJsonSerializer::Serialize(JsonObject.ToSharedRef(), JsonWriter, true);
+}
+
+bool FJsonObjectParameter::JsonObjectFromUtf8(TConstArrayView<uint8> Bytes)
+{
+	JsonString.Empty();
+	if (Bytes.IsEmpty())
+	{
+		JsonObject = MakeShared<FJsonObject>();
+		return true;
+	}
+	FMemoryReaderView Archive(Bytes);
+	TSharedRef<TJsonReader<UTF8CHAR>> JsonReader = TJsonReaderFactory<UTF8CHAR>::Create(&Archive);
 	return FJsonSerializer::Deserialize(JsonReader, JsonObject);
 }
 
@@ -24,7 +24,40 @@ private:
 
 	UFUNCTION(BlueprintCallable, Category="MCP")
 	static FString SafeCallCPPFunction(FMCPCommandDelegate Callable, const FString& Parameter);
-	
+
+	/** Call a handler from the native tool registry by name, skipping the python delegate round-trip. */
+	UFUNCTION(BlueprintCallable, Category="MCP")
+	static FString CallTool(const FString& Name, const FString& Parameter);
+
+	/**
+	 * UTF-8 variant of CallTool: the request is parsed from and the response written to UTF-8 bytes,
+	 * so the json never exists as a TCHAR string on the C++ side.
+	 */
+	UFUNCTION(BlueprintCallable, Category="MCP")
+	static TArray<uint8> CallToolUtf8(const FString& Name, const TArray<uint8>& Parameter);
+
+	/** Run several registry tools in one call and one transaction, see FMCPToolRegistry::CallBatch. */
+	UFUNCTION(BlueprintCallable, Category="MCP")
+	static FString BatchCall(const FString& Parameter);
+
+	/** Schedule a registry tool through FMCPToolScheduler; thread-safe tools run off the game thread. */
+	UFUNCTION(BlueprintCallable, Category="MCP")
+	static int64 SubmitTool(const FString& Name, const FString& Parameter);
+
+	/** Result of a submitted tool, or an empty string while it is still running. */
+	UFUNCTION(BlueprintCallable, Category="MCP")
+	static FString TryGetToolResult(int64 RequestId);
+
+	/** Re-serialize json text in the given wire format (see EMCPJsonFormat). */
+	UFUNCTION(BlueprintCallable, Category="MCP")
+	static FString FormatJson(const FString& Json, EMCPJsonFormat Format);
+
+	UFUNCTION(BlueprintCallable, Category="MCP")
+	static bool HasTool(const FString& Name);
+
+	UFUNCTION(BlueprintCallable, Category="MCP")
+	static TArray<FString> ListTools();
+
 
 #pragma region Blueprint
 
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DeveloperSettings.h"
+#include "Structure/MCPStructure.h"
 #include "MCPSetting.generated.h"
 
 /**
@@ -21,4 +22,24 @@ public:
 	int Port = 8422;
 	UPROPERTY(Config, BlueprintReadWrite, EditAnywhere, Category = "MCP")
 	bool bAutoStart = false;
+
+	/** Format of tool results sent to the MCP client; applied once by the python server when a tool returns. */
+	UPROPERTY(Config, BlueprintReadWrite, EditAnywhere, Category = "MCP")
+	EMCPJsonFormat ResponseFormat = EMCPJsonFormat::Compact;
+
+	/** Game-thread time (ms) spent draining queued tool tasks per tick while the editor is in use. */
+	UPROPERTY(Config, BlueprintReadWrite, EditAnywhere, Category = "MCP|Scheduling", meta = (ClampMin = "0.5", UIMin = "0.5", UIMax = "33"))
+	float TaskBudgetMs = 4.f;
+
+	/** Budget used when the editor is unfocused or idle; large enough to drain big batches in one go. */
+	UPROPERTY(Config, BlueprintReadWrite, EditAnywhere, Category = "MCP|Scheduling", meta = (ClampMin = "0.5", UIMin = "0.5", UIMax = "1000"))
+	float IdleTaskBudgetMs = 100.f;
+
+	/** Seconds without user input after which the editor counts as idle. */
+	UPROPERTY(Config, BlueprintReadWrite, EditAnywhere, Category = "MCP|Scheduling", meta = (ClampMin = "0"))
+	float IdleAfterSeconds = 5.f;
+
+	/** Run the python task tick every N frames while tasks are pending. */
+	UPROPERTY(Config, BlueprintReadWrite, EditAnywhere, Category = "MCP|Scheduling", meta = (ClampMin = "1", UIMin = "1", UIMax = "10"))
+	int32 TaskTickInterval = 1;
 };
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include <atomic>
 #include "Async/Future.h"
 #include "Structure/MCPStructure.h"
 #include "UObject/Object.h"
@@ -60,6 +61,29 @@ public:
 
 	UFUNCTION(BlueprintCallable ,Category="MCPLibrary|RemoteMCP")
 	EMCPServerState GetMCPServeState() const;
+
+	/** Pushed by python on every server state transition; read without re-entering python. */
+	UFUNCTION(BlueprintCallable ,Category="MCPLibrary|RemoteMCP")
+	void SetServerState(EMCPServerState State);
+
+	/** Called by python (from any thread) when a task is queued for the game thread. */
+	UFUNCTION(BlueprintCallable ,Category="MCPLibrary|RemoteMCP")
+	void NotifyTaskQueued();
+
+	/** Called by python at the end of each tick: true while queued or in-flight tasks remain. */
+	UFUNCTION(BlueprintCallable ,Category="MCPLibrary|RemoteMCP")
+	void SetPendingWork(bool bPending);
+
+	/** Milliseconds python may spend draining tasks this tick: TaskBudgetMs, or IdleTaskBudgetMs when the editor is idle. */
+	UFUNCTION(BlueprintCallable ,Category="MCPLibrary|RemoteMCP")
+	float GetTaskBudgetMs() const;
+
+	/** True when the editor has no focus or no user input for IdleAfterSeconds. */
+	UFUNCTION(BlueprintCallable ,Category="MCPLibrary|RemoteMCP")
+	bool IsEditorIdle() const;
+private:
+	bool IsServerActive() const;
+	bool IsServerRunning() const;
 private:
 	UFUNCTION(BlueprintCallable,Category="MCPLibrary|RemoteMCP")
 	void SetupObject(FMCPObject Context);
@@ -72,9 +96,14 @@ private:
 	FMCPObject MCPContext;
 	TFuture<void> RunTread;
 	int TickCount = 0;
-	static constexpr int TickInterval = 2;
 	bool WaitStart = false;
 
+	std::atomic<uint8> ServerState{ static_cast<uint8>(EMCPServerState::Stop) };
+	// Bumped for every queued task; Tick only calls into python when it moved or work is still pending.
+	std::atomic<uint32> QueuedTaskSerial{ 0 };
+	uint32 ServedTaskSerial = 0;
+	bool bPendingWork = false;
+
 	static UMCPSubsystem* Instance;
 	friend class FRemoteMCPModule;
 };
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class AActor;
+class FProperty;
+
+/**
+ * Server-side actor query shared by the level listing tools.
+ *
+ * Every criterion is optional and all of them must hold:
+ *	"class": "StaticMeshActor", "include_subclasses": true
+ *	"tags": ["Foliage", "Tree"], "tag_match": "all" | "any"
+ *	"folder": "Props/Trees"          outliner folder, subfolders included
+ *	"level": "SubLevel_A"            level (world) name or package path
+ *	"data_layer": "Lighting"         data layer short or full name
+ *	"name_contains": "Lamp"          object name or label substring
+ *	"where": [{"property": "bHidden", "op": "==", "value": false}]
+ *
+ * Candidates come from FMCPActorIndex (by class or tag when given) and the rest is evaluated in one pass.
+ */
+class REMOTEMCP_API FMCPActorFilter
+{
+public:
+	bool Parse(const FJsonObject& Params, FString& OutError);
+
+	/** Collect the actors of the current world that pass the filter. */
+	void Gather(TArray<AActor*>& OutActors) const;
+
+	bool Matches(AActor* Actor) const;
+
+private:
+	enum class EOp : uint8
+	{
+		Equal,
+		NotEqual,
+		Less,
+		LessEqual,
+		Greater,
+		GreaterEqual,
+		Contains,
+	};
+
+	struct FPredicate
+	{
+		FName Property;
+		EOp Op = EOp::Equal;
+		TSharedPtr<FJsonValue> Value;
+		/** The property differs per actor class; resolved once per class. */
+		mutable TMap<const UClass*, FProperty*> PropertyCache;
+	};
+
+	static bool ParseOp(const FString& Text, EOp& OutOp);
+	template<typename T>
+	static bool Compare(const T& A, const T& B, EOp Op);
+	bool Evaluate(const FPredicate& Predicate, AActor* Actor) const;
+
+	const UClass* Class = nullptr;
+	bool bIncludeSubclasses = true;
+	TArray<FName> Tags;
+	bool bMatchAllTags = true;
+	FString Folder;
+	FString Level;
+	FString DataLayer;
+	FString NameContains;
+	TArray<FPredicate> Predicates;
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+class UWorld;
+
+/**
+ * Editor-side lookup table of the actors in the current world, shared by the UMCPEditorTools handlers.
+ *
+ * Actors are indexed by object name, label, path, class and tag. The index is built lazily on the first query for a
+ * world and then kept current through the level-actor added/deleted, label-changed and property-changed delegates, so
+ * single-actor tools no longer sweep the whole world. Bulk changes (undo, level streaming, map change) just mark the
+ * index dirty and it is rebuilt on the next query.
+ *
+ * Game thread only, like the handlers that use it.
+ */
+class REMOTEMCP_API FMCPActorIndex
+{
+public:
+	static FMCPActorIndex& Get();
+
+	void Initialize();
+	void Shutdown();
+
+	/** Resolve an actor by object name, then full path, then label. */
+	AActor* FindActor(const FString& Identifier);
+
+	/**
+	 * Object names are only unique within a level. When actors of several (streaming) levels share Name, the one in
+	 * the persistent level wins, then the one with the lowest path; FindByPath picks a specific one.
+	 */
+	AActor* FindByName(FName Name);
+	AActor* FindByPath(const FString& Path);
+	/** Labels are not unique; returns the first match. */
+	AActor* FindByLabel(const FString& Label);
+
+	void FindByClass(const UClass* Class, bool bIncludeSubclasses, TArray<AActor*>& OutActors);
+	void FindByTag(FName Tag, TArray<AActor*>& OutActors);
+	void GetAllActors(TArray<AActor*>& OutActors);
+
+	/** Force a full rebuild on the next query. */
+	void Invalidate();
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FName Name;
+		FString Label;
+		FString Path;
+		const UClass* Class = nullptr;
+		TArray<FName> Tags;
+	};
+
+	UWorld* GetIndexedWorld();
+	void EnsureBuilt();
+	void AddActor(AActor* Actor);
+	void RemoveActor(AActor* Actor);
+	void RemoveEntry(const FObjectKey& Key);
+	/** Refresh the keys of an actor that may have been renamed, relabelled or retagged. */
+	void ReindexActor(AActor* Actor);
+	bool IsIndexable(const AActor* Actor) const;
+
+	void OnLevelActorAdded(AActor* Actor);
+	void OnLevelActorDeleted(AActor* Actor);
+	void OnActorLabelChanged(AActor* Actor);
+	void OnObjectPropertyChanged(UObject* Object, struct FPropertyChangedEvent& Event);
+
+	TWeakObjectPtr<UWorld> World;
+	bool bDirty = true;
+
+	TMap<FObjectKey, FEntry> Entries;
+	TMultiMap<FName, FObjectKey> ByName;
+	TMap<FString, FObjectKey> ByPath;
+	TMultiMap<FString, FObjectKey> ByLabel;
+	TMultiMap<const UClass*, FObjectKey> ByClass;
+	TMultiMap<FName, FObjectKey> ByTag;
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorListChangedHandle;
+	FDelegateHandle LabelChangedHandle;
+	FDelegateHandle PropertyChangedHandle;
+	FDelegateHandle MapChangeHandle;
+};
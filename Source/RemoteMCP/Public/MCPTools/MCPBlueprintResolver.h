@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+struct FAssetData;
+class UBlueprint;
+
+/**
+ * Finds Blueprint assets (actor, widget, editor utility and any other UBlueprint subclass) by asset name or path.
+ *
+ * Names are looked up in an index of every Blueprint known to the asset registry, built on first use and kept current
+ * from the registry's added / removed / renamed events, so no lookup scans the registry or guesses a folder. Loaded
+ * Blueprints are cached weakly by path. A name carried by more than one asset is reported as ambiguous together with
+ * the candidate paths instead of picking one.
+ *
+ * Game thread only.
+ */
+class REMOTEMCP_API FMCPBlueprintResolver
+{
+public:
+	static FMCPBlueprintResolver& Get();
+
+	void Initialize();
+	void Shutdown();
+
+	/**
+	 * The Blueprint called Name ("BP_Door") or found at Name ("/Game/Doors/BP_Door" or "/Game/Doors/BP_Door.BP_Door"),
+	 * loading it if needed. BlueprintClass restricts the match to a Blueprint type such as UWidgetBlueprint.
+	 * Returns null with OutError set when nothing or more than one asset matches.
+	 */
+	UBlueprint* Resolve(const FString& Name, FString& OutError, const UClass* BlueprintClass = nullptr);
+
+	/** Drop the index and the loaded cache; the index is rebuilt on the next lookup. */
+	void Reset();
+
+private:
+	struct FEntry
+	{
+		FSoftObjectPath Path;
+		/** Null when the asset's Blueprint type lives in a module that is not loaded. */
+		const UClass* AssetClass = nullptr;
+	};
+
+	void BuildIndex();
+	void AddAsset(const FAssetData& Asset, const UClass* AssetClass);
+	void RemoveAsset(FName Name, const FSoftObjectPath& Path);
+	UBlueprint* Load(const FSoftObjectPath& Path, const UClass* BlueprintClass);
+
+	void OnAssetAdded(const FAssetData& Asset);
+	void OnAssetRemoved(const FAssetData& Asset);
+	void OnAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath);
+
+	TMultiMap<FName, FEntry> ByName;
+	TMap<FSoftObjectPath, TWeakObjectPtr<UBlueprint>> Loaded;
+	bool bIndexed = false;
+
+	FDelegateHandle AddedHandle;
+	FDelegateHandle RemovedHandle;
+	FDelegateHandle RenamedHandle;
+};
@@ -14,6 +14,8 @@ class REMOTEMCP_API UMCPBlueprintTools : public UBlueprintFunctionLibrary
 {
 	GENERATED_BODY()
 
+	friend class FMCPToolRegistry;
+
 	/**
 	 * 创建一个新的蓝图。
 	 * @param Params 包含蓝图创建所需的参数。
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+
+/**
+ * Level revision counter plus a bounded journal of actor changes in the current editor world.
+ *
+ * Fed from the level actor added/deleted, actor moved, label changed and property changed delegates (and from the
+ * MCP handlers that write without going through PostEditChange). Every change bumps the revision; a client that
+ * remembers the revision of its last listing can ask for just the delta instead of listing the level again.
+ *
+ * Bulk changes the delegates cannot describe (undo, level streaming, map change) and history trimmed off the
+ * journal set a reset barrier: asking for changes older than that returns "reset" and the client lists again.
+ */
+class REMOTEMCP_API FMCPChangeJournal
+{
+public:
+	enum class EChange : uint8
+	{
+		Added,
+		Removed,
+		Modified,
+	};
+
+	struct FChange
+	{
+		int64 Revision = 0;
+		EChange Kind = EChange::Modified;
+		FObjectKey Key;
+		TWeakObjectPtr<AActor> Actor;
+		/** Last known name and path, for when the actor is gone by the time the change is read. */
+		FString Name;
+		FString Path;
+		FName Property;
+	};
+
+	/** The net effect on one actor over a range of revisions. */
+	struct FActorDelta
+	{
+		EChange Kind = EChange::Modified;
+		TWeakObjectPtr<AActor> Actor;
+		FString Name;
+		FString Path;
+		TArray<FName> Properties;
+	};
+
+	static FMCPChangeJournal& Get();
+
+	void Initialize();
+	void Shutdown();
+
+	int64 GetRevision() const
+	{
+		return Revision;
+	}
+
+	/**
+	 * Net adds, removes and modifications after revision Since, in order of first change.
+	 * Returns false when Since predates the retained history; the caller has to list the level again.
+	 */
+	bool GetChangesSince(int64 Since, TArray<FActorDelta>& OutDeltas) const;
+
+	void RecordModified(AActor* Actor, FName Property = NAME_None);
+
+private:
+	void Record(EChange Kind, AActor* Actor, FName Property);
+	/** Something changed that the journal cannot describe; older revisions can no longer be diffed. */
+	void Reset();
+
+	void OnLevelActorAdded(AActor* Actor);
+	void OnLevelActorDeleted(AActor* Actor);
+	void OnActorMoved(AActor* Actor);
+	void OnActorLabelChanged(AActor* Actor);
+	void OnObjectPropertyChanged(UObject* Object, struct FPropertyChangedEvent& Event);
+
+	int64 Revision = 0;
+	/** Requests for revisions below this get a reset. */
+	int64 ResetRevision = 0;
+	TArray<FChange> Changes;
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorListChangedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle LabelChangedHandle;
+	FDelegateHandle PropertyChangedHandle;
+	FDelegateHandle MapChangeHandle;
+	FDelegateHandle UndoRedoHandle;
+};
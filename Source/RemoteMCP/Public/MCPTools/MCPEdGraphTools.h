@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Structure/JsonParameter.h"
+#include "MCPTools/MCPPagination.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "MCPEdGraphTools.generated.h"
 
@@ -12,16 +13,26 @@ class REMOTEMCP_API UMCPEdGraphTools : public UBlueprintFunctionLibrary
 
 public:
 	// ──── Existing graph query/edit tools ────
+	// Handlers tagged MCPThreadSafe only read already-loaded objects when called off the game thread and
+	// answer FMCPToolRegistry::MakeGameThreadRequiredResponse() when they would have to load something.
 
 	/** Discover EdGraphs inside any asset. */
-	UFUNCTION(BlueprintCallable, Category = "MCP|EdGraph")
+	UFUNCTION(BlueprintCallable, Category = "MCP|EdGraph", meta = (MCPThreadSafe))
 	static FJsonObjectParameter HandleFindGraphsInAsset(const FJsonObjectParameter& Params);
 
-	/** List all nodes in an EdGraph. When include_properties=true, returns ExportText for every UPROPERTY. */
-	UFUNCTION(BlueprintCallable, Category = "MCP|EdGraph")
+	/**
+	 * List all nodes in an EdGraph. When include_properties=true, returns the typed json value (see FMCPPropertyCodec)
+	 * of every UPROPERTY, plus its ExportText with include_export_text=true.
+	 * Supports limit / cursor / fields (see FMCPPageRequest); pages are in node guid order.
+	 * Off the game thread only when "fields" leaves out title, which runs node code.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCP|EdGraph", meta = (MCPThreadSafe))
 	static FJsonObjectParameter HandleListGraphNodes(const FJsonObjectParameter& Params);
 
-	/** Get a single node by guid/name/path (always includes ExportText properties). */
+	/**
+	 * Get a single node by guid/name/path, always with its properties as typed json values; include_export_text=true
+	 * adds their ExportText. Not thread-safe: it writes the title.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "MCP|EdGraph")
 	static FJsonObjectParameter HandleGetGraphNode(const FJsonObjectParameter& Params);
 
@@ -33,8 +44,8 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MCP|EdGraph")
 	static FJsonObjectParameter HandleSetNodeProperties(const FJsonObjectParameter& Params);
 
-	/** List all pin connections in the graph. */
-	UFUNCTION(BlueprintCallable, Category = "MCP|EdGraph")
+	/** List all pin connections in the graph. Supports limit / cursor / fields (endpoint fields). */
+	UFUNCTION(BlueprintCallable, Category = "MCP|EdGraph", meta = (MCPThreadSafe))
 	static FJsonObjectParameter HandleListGraphLinks(const FJsonObjectParameter& Params);
 
 	/** Connect two pins. */
@@ -70,6 +81,27 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MCP|EdGraph")
 	static FJsonObjectParameter HandleSetPinDefaultValue(const FJsonObjectParameter& Params);
 
+	/**
+	 * Apply a declarative edit to one graph in a single transaction, with one graph-changed notification for everything
+	 * it adds and one MarkBlueprintAsModified, instead of one call per node, link and default. Deleted nodes are
+	 * destroyed through DestroyNode, which still reports each removal. Order: delete, nodes, comments, properties (each
+	 * touched node is reconstructed), links, defaults.
+	 * Node references are a local id from this patch, else the guid or object name of an existing node.
+	 * The patch is validated (ids, classes, references) before anything changes; pin-level failures are reported in errors[].
+	 * @param Params:
+	 *   - graph_path (string, required)
+	 *   - delete (string[], optional) — guids/names of existing nodes, removed first
+	 *   - nodes (array, optional) — [{id, node_class, pos_x, pos_y, import_text, pin_defaults}] as in HandleAddNode
+	 *   - comments (array, optional) — [{id (optional), comment, pos_x, pos_y, width, height}]
+	 *   - links (array, optional) — [{from_node, from_pin, to_node, to_pin}]
+	 *   - defaults (array, optional) — [{node, pin, value, object (optional), direction (optional)}]
+	 *   - properties (array, optional) — [{node, values: {PropertyName: value}}]
+	 *   - transaction (bool, default true), transaction_name, auto_save_asset_path (optional)
+	 * @return ids {local id: node guid}, created, deleted, linked, defaults_set, errors[] (when any)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCP|EdGraph")
+	static FJsonObjectParameter HandleApplyGraphPatch(const FJsonObjectParameter& Params);
+
 	/**
 	 * Compile any Blueprint-derived asset and return diagnostics.
 	 * @param Params: asset_path (required)
@@ -96,14 +128,20 @@ public:
 	 * Query asset metadata: parent class, variables, functions, interfaces, components, graphs.
 	 * @param Params: asset_path (required)
 	 */
-	UFUNCTION(BlueprintCallable, Category = "MCP|EdGraph")
+	UFUNCTION(BlueprintCallable, Category = "MCP|EdGraph", meta = (MCPThreadSafe))
 	static FJsonObjectParameter HandleGetAssetInfo(const FJsonObjectParameter& Params);
 
 private:
 	static UEdGraphNode* FindNodeInGraph(UEdGraph* Graph, const FString& NodeGuid, const FString& NodeName, const FString& NodePath);
-	static TSharedPtr<FJsonObject> SerializeNode(UEdGraphNode* Node, bool bIncludeProperties = false);
-	static TSharedPtr<FJsonObject> SerializePin(UEdGraphPin* Pin);
+	/** Properties are written as codec values; bIncludeExportText adds each one's ExportText, the import_text format. */
+	static void WriteNode(FMCPJsonWriter::FWriter& Writer, UEdGraphNode* Node, bool bIncludeProperties = false, bool bIncludeExportText = false, const FMCPFieldMask& Fields = FMCPFieldMask());
+	static void WritePin(FMCPJsonWriter::FWriter& Writer, UEdGraphPin* Pin);
 	static UEdGraphPin* FindPinOnNode(UEdGraphNode* Node, const FString& PinName, const FString& Direction = TEXT(""));
 	static bool SaveAssetIfNeeded(const FString& AssetPath);
-	static UClass* ResolveNodeClass(const FString& ClassName);
+	static UEdGraphNode* CreateNode(UEdGraph* Graph, UClass* NodeClass, int32 PosX, int32 PosY, const TSharedPtr<FJsonObject>& ImportText,
+		const TSharedPtr<FJsonObject>& PinDefaults, FJsonObject& OutImportErrors, FJsonObject& OutPinErrors);
+	static UEdGraphNode* CreateCommentNode(UEdGraph* Graph, const FString& Comment, int32 PosX, int32 PosY, int32 Width, int32 Height);
+	static void SetPinDefault(const class UEdGraphSchema* Schema, UEdGraphPin& Pin, const FString& DefaultValue);
+	static bool LinkPins(const class UEdGraphSchema* Schema, UEdGraphPin* FromPin, UEdGraphPin* ToPin);
+	static UObject* LoadObjectForRead(UClass* Class, const FString& Path);
 };
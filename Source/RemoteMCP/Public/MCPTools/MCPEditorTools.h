@@ -20,8 +20,9 @@ class REMOTEMCP_API UMCPEditorTools : public UBlueprintFunctionLibrary
 
 public:
 	/**
-	 * 获取当前关卡中的所有Actor
-	 * @param Params - 输入参数(不需要特定参数)
+	 * 获取当前关卡中的Actor，支持服务端过滤
+	 * @param Params - 可选过滤: class, include_subclasses, tags, tag_match, folder, level, data_layer, name_contains, where
+	 *                 可选分页: limit(int), cursor(string), fields(string/array，额外可选 label/folder/level/tags)，按Actor路径分页
 	 * @return 包含所有Actor信息的JSON对象
 	 */
 	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
@@ -29,12 +30,52 @@ public:
 	
 	/**
 	 * 根据名称模式查找Actor
-	 * @param Params - 输入参数，必须包含"pattern"字段
+	 * @param Params - 输入参数，必须包含"pattern"字段，可选 limit/cursor/fields 分页
 	 * @return 包含匹配Actor信息的JSON对象
 	 */
 	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
 	static FJsonObjectParameter HandleFindActorsByName(const FJsonObjectParameter& Params);
 	
+	/**
+	 * 查找与球体相交的Actor(空间索引)
+	 * @param Params - 输入参数，必须包含"radius"及"center"或"actor"之一，可选"limit"、"cursor"和"fields"
+	 * @return 按距离排序的Actor列表，每项带"distance"
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
+	static FJsonObjectParameter HandleFindActorsInRadius(const FJsonObjectParameter& Params);
+
+	/**
+	 * 查找与轴对齐包围盒相交的Actor(空间索引)
+	 * @param Params - 输入参数，必须包含"min"和"max"字段，可选"fully_inside"、"limit"、"cursor"和"fields"
+	 * @return 按到盒中心距离排序的Actor列表
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
+	static FJsonObjectParameter HandleFindActorsInBox(const FJsonObjectParameter& Params);
+
+	/**
+	 * 查找当前活动视口视锥内的Actor(空间索引)
+	 * @param Params - 输入参数，可选"max_distance"、"limit"、"cursor"和"fields"
+	 * @return 按到相机距离排序的Actor列表
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
+	static FJsonObjectParameter HandleFindActorsInViewFrustum(const FJsonObjectParameter& Params);
+
+	/**
+	 * 查找距离指定点或Actor最近的K个Actor(空间索引)
+	 * @param Params - 输入参数，必须包含"center"或"actor"之一，可选"count"(默认10)、"max_distance"和"fields"
+	 * @return 按距离排序的Actor列表
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
+	static FJsonObjectParameter HandleFindNearestActors(const FJsonObjectParameter& Params);
+
+	/**
+	 * 获取某个关卡修订号之后的Actor增量变化
+	 * @param Params - 必须包含"revision"(上次列表或增量返回的revision)，可选"fields"
+	 * @return {"revision", "since", "reset", "added", "modified", "removed"}；reset为true时需重新列出关卡
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
+	static FJsonObjectParameter HandleGetActorChangesSince(const FJsonObjectParameter& Params);
+
 	/**
 	 * 在关卡中生成新的Actor
 	 * @param Params - 输入参数，必须包含"type"和"name"字段，可选"location"、"rotation"和"scale"
@@ -60,9 +101,11 @@ public:
 	static FJsonObjectParameter HandleSetActorTransform(const FJsonObjectParameter& Params);
 	
 	/**
-	 * 获取Actor的所有属性
-	 * @param Params - 输入参数，必须包含"name"字段
-	 * @return 包含Actor详细属性的JSON对象
+	 * 获取Actor及其组件的属性
+	 * 默认只返回与原型(CDO/蓝图默认值/组件模板)不同的属性，并受深度和输出大小限制
+	 * @param Params - 输入参数，必须包含"name"字段；可选"max_depth"、"max_bytes"、"non_default_only"、
+	 *                 "paths"/"exclude"(属性路径过滤，组件属性以组件名开头)、"include_components"
+	 * @return Actor的基本信息、"properties"、"components"以及"truncated"/"omitted"
 	 */
 	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
 	static FJsonObjectParameter HandleGetActorProperties(const FJsonObjectParameter& Params);
@@ -75,6 +118,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
 	static FJsonObjectParameter HandleSetActorProperty(const FJsonObjectParameter& Params);
 
+	/**
+	 * 批量设置Actor变换，整体作为一个事务，编辑器通知推迟到最后
+	 * @param Params - 必须包含"items": [{"actor", 可选"location"/"rotation"/"scale"/"relative"}]，可选"transaction"和"transaction_name"
+	 * @return 每项结果及 updated/failed 计数
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
+	static FJsonObjectParameter HandleBulkSetActorTransforms(const FJsonObjectParameter& Params);
+
+	/**
+	 * 批量设置Actor属性，整体作为一个事务，PostEditChange推迟到最后
+	 * @param Params - 必须包含"items": [{"actor", "property", "value"} 或 {"actor", "properties": {...}}]，可选"transaction"和"transaction_name"
+	 * @return 每项结果及 updated/failed 计数
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
+	static FJsonObjectParameter HandleBulkSetActorProperties(const FJsonObjectParameter& Params);
+
 	/**
 	 * 在关卡中生成蓝图Actor
 	 * @param Params - 输入参数，必须包含"blueprint_name"和"actor_name"字段，可选"location"、"rotation"和"scale"
@@ -83,6 +142,33 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
 	static FJsonObjectParameter HandleSpawnBlueprintActor(const FJsonObjectParameter& Params);
 
+	/**
+	 * 批量延迟生成Actor，整批一个事务，最后统一标脏关卡和刷新视口
+	 * @param Params - 必须包含"class"或"blueprint"，以及"instances": [{"name"?, "location"?, "rotation"?, "scale"?, "properties"?}]
+	 *                 可选"properties"(所有实例共享)、"folder"、"transaction"、"transaction_name"
+	 *                 "mode": "instanced" 时需要"mesh"，所有实例写入一个InstancedStaticMeshComponent
+	 * @return 每项结果及 spawned(已生成的Actor数)/failed(success=false的项数，属性写入失败的已生成Actor也计入)；
+	 *         instanced模式返回承载Actor和实例数，且不支持"properties"
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
+	static FJsonObjectParameter HandleBulkSpawnActors(const FJsonObjectParameter& Params);
+
+	/**
+	 * 把Actor及其组件的当前状态序列化到内存快照中，用于试探性编辑后的快速回滚
+	 * @param Params - 可选"actors": [名称/路径]，缺省时使用编辑器当前选中的Actor
+	 * @return "snapshot_id"、快照包含的Actor和字节数
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
+	static FJsonObjectParameter HandleSnapshotActors(const FJsonObjectParameter& Params);
+
+	/**
+	 * 一次性把快照写回对应的Actor和组件(可撤销的单个事务)
+	 * @param Params - 必须包含"snapshot_id"；可选"discard"(恢复后删除快照)、"transaction"、"transaction_name"
+	 * @return 已恢复的Actor以及已不存在的Actor路径("missing")
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCP|Blueprint")
+	static FJsonObjectParameter HandleRestoreSnapshot(const FJsonObjectParameter& Params);
+
 	/**
 	 * 设置编辑器视口的焦点
 	 * @param Params - 输入参数，必须包含"target"或"location"字段之一，可选"distance"和"orientation"
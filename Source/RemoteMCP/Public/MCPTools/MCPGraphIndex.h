@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraph/EdGraphPin.h"
+#include "UObject/ObjectKey.h"
+
+class UEdGraph;
+class UEdGraphNode;
+struct FEdGraphEditAction;
+
+/**
+ * Node and pin lookups for the graph handlers, by guid, object name or path instead of a walk over the graph per call.
+ *
+ * Each graph gets its tables on first lookup and keeps them current from its own graph-changed notifications: node
+ * adds and removes are applied to the tables, edited nodes drop their pins, and only a notification that does not say
+ * what changed rebuilds the tables. Edits made without a notification are covered too: a hit is checked against the node it
+ * returns, and a miss rebuilds the tables once before it is reported. Pins are indexed per node by (name, direction)
+ * and checked against the node's current pin list on every hit, since reconstructing a node replaces its pins.
+ *
+ * The tables are used on the game thread only; other threads fall back to a plain scan.
+ */
+class REMOTEMCP_API FMCPGraphIndex
+{
+public:
+	static FMCPGraphIndex& Get();
+
+	void Shutdown();
+
+	/** The node with this guid (any FGuid text form), else the node with this object name. */
+	UEdGraphNode* FindNode(UEdGraph* Graph, const FString& Guid, const FString& Name = FString());
+
+	/** A node by object path; resolved through Graph's tables when it lies in Graph, else looked up or loaded. */
+	UEdGraphNode* FindNodeByPath(const FString& Path, UEdGraph* Graph = nullptr);
+
+	/** The pin called Name on Node; EGPD_MAX matches either direction. */
+	UEdGraphPin* FindPin(UEdGraphNode* Node, const FString& Name, EEdGraphPinDirection Direction = EGPD_MAX);
+
+	/** Drop the tables of one graph, e.g. after a batch of edits that did not notify. */
+	void Invalidate(const UEdGraph* Graph);
+
+	void Reset();
+
+private:
+	struct FPinKey
+	{
+		FName Name;
+		EEdGraphPinDirection Direction;
+
+		bool operator==(const FPinKey& Other) const
+		{
+			return Name == Other.Name && Direction == Other.Direction;
+		}
+
+		friend uint32 GetTypeHash(const FPinKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.Name), static_cast<uint32>(Key.Direction));
+		}
+	};
+
+	struct FGraphTables
+	{
+		TWeakObjectPtr<UEdGraph> Graph;
+		FDelegateHandle ChangedHandle;
+		bool bBuilt = false;
+
+		/** Weak, so a node garbage collected since the last build resolves to null instead of freed memory. */
+		TMap<FGuid, TWeakObjectPtr<UEdGraphNode>> ByGuid;
+		TMap<FName, TWeakObjectPtr<UEdGraphNode>> ByName;
+		/** Filled per node on its first pin lookup. */
+		TMap<FObjectKey, TMap<FPinKey, UEdGraphPin*>> Pins;
+	};
+
+	FGraphTables& GetTables(UEdGraph* Graph);
+	void Build(FGraphTables& Tables);
+	void OnGraphChanged(const FEdGraphEditAction& Action, FObjectKey GraphKey);
+	void Unregister(FGraphTables& Tables);
+
+	TMap<FObjectKey, TUniquePtr<FGraphTables>> Graphs;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "Structure/JsonParameter.h"
+
+/**
+ * Streams a handler response straight into condensed json text instead of building an FJsonObject DOM.
+ *
+ * Large listings (actors, graph nodes, widget trees) otherwise cost several shared-pointer allocations per field.
+ * The finished buffer is wrapped with FJsonObjectParameter::FromSerializedString and reaches python unchanged;
+ * it is only parsed back into a DOM if a C++ caller (e.g. a batch $ref) dereferences the result.
+ *
+ *	FMCPJsonWriter Writer;
+ *	Writer.BeginSuccessResponse();
+ *	Writer->WriteArrayStart(TEXT("nodes"));
+ *	...
+ *	Writer->WriteArrayEnd();
+ *	return Writer.Finish();
+ */
+class REMOTEMCP_API FMCPJsonWriter
+{
+public:
+	using FWriter = TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>;
+
+	explicit FMCPJsonWriter(int32 ReserveChars = 0);
+
+	FMCPJsonWriter(const FMCPJsonWriter&) = delete;
+	FMCPJsonWriter& operator=(const FMCPJsonWriter&) = delete;
+
+	FWriter& Get() const
+	{
+		return *Writer;
+	}
+
+	FWriter* operator->() const
+	{
+		return &Writer.Get();
+	}
+
+	/** Characters written so far, for handlers that cap their output size. */
+	int32 GetLength() const
+	{
+		return Buffer.Len();
+	}
+
+	/** Open the root object. Finish() closes it. */
+	void BeginObject();
+
+	/** Open {"success":true,"data":{ , the layout of FUnrealMCPCommonUtils::CreateSuccessResponse. Finish() closes it. */
+	void BeginSuccessResponse();
+
+	/** Close the scopes opened by Begin* and hand the text over as a parameter. The writer is spent afterwards. */
+	FJsonObjectParameter Finish();
+
+	/** Write a value that already exists as a DOM (e.g. request fields echoed back) under Identifier. */
+	void WriteJsonValue(const FString& Identifier, const TSharedPtr<FJsonValue>& Value);
+	void WriteJsonObject(const FString& Identifier, const TSharedPtr<FJsonObject>& Object);
+
+	static void WriteVector(FWriter& Writer, const FString& Identifier, const FVector& Value);
+	static void WriteRotator(FWriter& Writer, const FString& Identifier, const FRotator& Value);
+
+private:
+	FString Buffer;
+	TSharedRef<FWriter> Writer;
+	int32 OpenScopes = 0;
+};
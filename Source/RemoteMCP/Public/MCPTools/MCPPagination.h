@@ -0,0 +1,135 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Algo/BinarySearch.h"
+#include "MCPTools/MCPJsonWriter.h"
+#include "Structure/JsonParameter.h"
+
+/**
+ * Field projection for list responses ("fields": "name,guid" or ["name", "guid"]).
+ * An empty mask selects every field.
+ */
+class REMOTEMCP_API FMCPFieldMask
+{
+public:
+	void Parse(const FJsonObject& Params);
+
+	bool IsAll() const
+	{
+		return Fields.IsEmpty();
+	}
+
+	bool Has(const TCHAR* Field) const
+	{
+		return Fields.IsEmpty() || Fields.Contains(Field);
+	}
+
+	/** True only when Field was named explicitly; for optional fields that are left out of the default set. */
+	bool HasExplicit(const TCHAR* Field) const
+	{
+		return Fields.Contains(Field);
+	}
+
+	/** Drop the fields of Object that are not selected. */
+	void Project(FJsonObject& Object) const;
+
+private:
+	// a handful of names at most; a linear scan beats hashing here
+	TArray<FString> Fields;
+};
+
+/**
+ * Uniform limit / cursor / fields contract of the list-style handlers.
+ *
+ * Keyed listings (ApplyKeyed) sort items by a unique key and the cursor remembers the last key returned, so paging
+ * keeps working when items are added or removed in between. Ordered listings (ApplyOrdered) only remember a position:
+ * if the list changes between pages, items can be skipped or returned twice.
+ * Cursors are opaque to callers and only valid for the listing (scope) and the query parameters that produced them;
+ * only "limit" may change between pages.
+ *
+ *	FMCPPageRequest Page;
+ *	if (!Page.Parse(Params, TEXT("actors"), Error)) { return CreateErrorResponse(Error); }
+ *	Page.ApplyKeyed(Actors, [](AActor* Actor) { return Actor->GetPathName(); });
+ *	...
+ *	Page.WritePageInfo(Writer.Get());
+ */
+class REMOTEMCP_API FMCPPageRequest
+{
+public:
+	/** Read "limit" (0 or absent = everything), "cursor" and "fields". Fails on a cursor from another listing or query. */
+	bool Parse(const FJsonObjectParameter& Params, const TCHAR* InScope, FString& OutError);
+
+	const FMCPFieldMask& GetFields() const
+	{
+		return Fields;
+	}
+
+	/** Sort Items by a unique string key and keep only the requested page. */
+	template<typename ItemType, typename KeyFuncType>
+	void ApplyKeyed(TArray<ItemType>& Items, KeyFuncType&& KeyOf)
+	{
+		TArray<TPair<FString, ItemType>> Keyed;
+		Keyed.Reserve(Items.Num());
+		for (ItemType& Item : Items)
+		{
+			Keyed.Emplace(KeyOf(Item), MoveTemp(Item));
+		}
+		Keyed.Sort([](const TPair<FString, ItemType>& A, const TPair<FString, ItemType>& B)
+		{
+			return A.Key.Compare(B.Key, ESearchCase::CaseSensitive) < 0;
+		});
+
+		int32 Start = 0;
+		if (bHasCursor)
+		{
+			Start = Algo::UpperBoundBy(Keyed, After, [](const TPair<FString, ItemType>& Pair) -> const FString& { return Pair.Key; },
+				[](const FString& A, const FString& B) { return A.Compare(B, ESearchCase::CaseSensitive) < 0; });
+		}
+		const int32 End = Limit > 0 ? FMath::Min(Start + Limit, Keyed.Num()) : Keyed.Num();
+
+		Items.Reset(End - Start);
+		for (int32 Index = Start; Index < End; ++Index)
+		{
+			Items.Add(MoveTemp(Keyed[Index].Value));
+		}
+		Finish(Keyed.Num(), End, End > Start ? Keyed[End - 1].Key : FString());
+	}
+
+	/**
+	 * Page a listing that is already in a stable order. The cursor records the position, not an item, so it is only
+	 * exact while the listing is unchanged; prefer ApplyKeyed when items have a unique key.
+	 */
+	template<typename ItemType>
+	void ApplyOrdered(TArray<ItemType>& Items)
+	{
+		const int32 Count = Items.Num();
+		const int32 Start = bHasCursor ? FMath::Clamp(FCString::Atoi(*After) + 1, 0, Count) : 0;
+		const int32 End = Limit > 0 ? FMath::Min(Start + Limit, Count) : Count;
+
+		if (End < Count)
+		{
+			Items.RemoveAt(End, Count - End);
+		}
+		if (Start > 0)
+		{
+			Items.RemoveAt(0, Start);
+		}
+		Finish(Count, End, FString::FromInt(End - 1));
+	}
+
+	/** "total" and, when more items follow, "next_cursor". */
+	void WritePageInfo(FMCPJsonWriter::FWriter& Writer) const;
+	void SetPageInfo(FJsonObject& Object) const;
+
+private:
+	void Finish(int32 InTotal, int32 End, const FString& LastKey);
+
+	FMCPFieldMask Fields;
+	FString Scope;
+	FString QueryHash;
+	FString After;
+	FString NextCursor;
+	int32 Limit = 0;
+	int32 Total = 0;
+	bool bHasCursor = false;
+};
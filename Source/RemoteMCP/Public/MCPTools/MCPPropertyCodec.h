@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCPTools/MCPJsonWriter.h"
+
+class FJsonObject;
+class FJsonValue;
+
+/**
+ * Converts reflected property values to and from json without a round trip through ExportText / ImportText.
+ *
+ * Conversions are looked up in a table keyed by FFieldClass, walking up to the base field class, with per-struct
+ * fast paths checked first. The json layout is:
+ *	bool, numbers, strings, names and text map to their json counterparts; enums to the enumerator name
+ *	FVector, FVector2D, FRotator and FQuat are number arrays, FLinearColor and FColor are [r, g, b, a]
+ *	FTransform is {"location", "rotation", "scale"}; other structs are objects keyed by property name
+ *	TArray and TSet are arrays; TMap is an object when its key converts to a string, else a list of {"key", "value"}
+ *	object references are path strings or null; soft references are written without loading them
+ * Property types without an entry (delegates, interfaces, field paths) fall back to their text form.
+ *
+ * Reads are the inverse and also accept a few shorthands: numbers and enums as strings, a single number for all
+ * components of a vector, and structs either as arrays or as objects of their members.
+ */
+class REMOTEMCP_API FMCPPropertyCodec
+{
+public:
+	using FWriter = FMCPJsonWriter::FWriter;
+
+	static const FMCPPropertyCodec& Get();
+
+	/** Write one value without an identifier; inside an object call Writer.WriteIdentifierPrefix first. */
+	void Write(FWriter& Writer, const FProperty* Property, const void* Value) const;
+
+	/** Write the properties of Struct (a class or struct) found at Container as members of the open object. */
+	void WriteMembers(FWriter& Writer, const UStruct* Struct, const void* Container, EPropertyFlags SkipFlags = CPF_Deprecated) const;
+
+	/** Convert Json into the value at Value. Owner is the object holding the value, used as the outer for text imports. */
+	bool Read(const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError) const;
+	bool Read(const FProperty* Property, void* Value, const TSharedPtr<FJsonValue>& Json, UObject* Owner, FString& OutError) const;
+
+	/** Structs written as a compact array or fixed layout rather than as an object of their members. */
+	bool HasStructFastPath(const UScriptStruct* Struct) const
+	{
+		return ByStruct.Contains(Struct);
+	}
+
+	/** Assign the members of Struct at Container from the fields of Object; unknown fields are an error. */
+	bool ReadMembers(const UStruct* Struct, void* Container, const FJsonObject& Object, UObject* Owner, FString& OutError) const;
+
+private:
+	using FWriteFunc = void (*)(const FMCPPropertyCodec& Codec, FWriter& Writer, const FProperty* Property, const void* Value);
+	using FReadFunc = bool (*)(const FMCPPropertyCodec& Codec, const FProperty* Property, void* Value, const FJsonValue& Json, UObject* Owner, FString& OutError);
+
+	struct FEntry
+	{
+		FWriteFunc Write = nullptr;
+		FReadFunc Read = nullptr;
+	};
+
+	FMCPPropertyCodec();
+
+	const FEntry* FindEntry(const FProperty* Property) const;
+
+	TMap<const FFieldClass*, FEntry> ByFieldClass;
+	TMap<const UScriptStruct*, FEntry> ByStruct;
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCPTools/MCPJsonWriter.h"
+
+class FJsonObject;
+
+/**
+ * Property dump of an object with depth and size budgets, for the inspection handlers.
+ *
+ * By default only the values that differ from the object's archetype (its class default object, Blueprint CDO or
+ * component template) are written. The comparison runs in the same walk as the output, member by member, so an
+ * edited struct contributes only its edited members. Paths use the FMCPPropertyPath syntax and can be used to select
+ * ("paths") or drop ("exclude") parts of the dump; a selected path also brings in everything below it.
+ *
+ * Anything left out because of the budgets is listed under "omitted" by WriteSummary, so callers can ask for it
+ * explicitly with "paths".
+ */
+class REMOTEMCP_API FMCPPropertyDump
+{
+public:
+	struct FOptions
+	{
+		/** Nesting of structs and containers below a top-level property. */
+		int32 MaxDepth = 4;
+		/** Stop adding properties once the response reaches this many characters. */
+		int32 MaxChars = 64 * 1024;
+		bool bNonDefaultOnly = true;
+		TArray<FString> Paths;
+		TArray<FString> Exclude;
+
+		/** Read "max_depth", "max_bytes", "non_default_only", "paths" and "exclude". */
+		void Parse(const FJsonObject& Params);
+	};
+
+	FMCPPropertyDump(FMCPJsonWriter& InWriter, const FOptions& InOptions);
+
+	/** Write the properties of Object as members of the open json object. Prefix roots its paths, e.g. a component name. */
+	void WriteObject(const UObject* Object, const FString& Prefix = FString());
+
+	/** Whether anything at or below Prefix passes the path filters. */
+	bool IsWanted(const FString& Prefix) const;
+
+	/** "truncated" and, when something was left out, "omitted". */
+	void WriteSummary() const;
+
+private:
+	enum class EMatch : uint8
+	{
+		Skip,
+		/** A selected path lies below this one; descend and filter the members. */
+		Partial,
+		All,
+	};
+
+	EMatch Match(const FString& Path) const;
+	bool IsDefault(const FProperty* Property, const void* Value, const void* Default) const;
+	bool NeedsDepth(const FProperty* Property) const;
+	bool HasBudget();
+	void Omit(const FString& Path);
+
+	void WriteMembers(const UStruct* Struct, const void* Container, const void* Defaults, const FString& Prefix, int32 Depth);
+	void WriteValue(const FProperty* Property, const void* Value, const void* Default, const FString& Path, int32 Depth);
+
+	FMCPJsonWriter& Writer;
+	const FOptions& Options;
+
+	const UObject* Root = nullptr;
+	const UObject* RootArchetype = nullptr;
+
+	TArray<FString> Omitted;
+	int32 OmittedCount = 0;
+	bool bTruncated = false;
+};
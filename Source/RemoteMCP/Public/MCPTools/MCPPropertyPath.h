@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class FJsonValue;
+class FMapProperty;
+
+/**
+ * A property path ("LightColor", "BodyInstance.MassScale", "Points[2].Location", "Settings[Key].Value") compiled
+ * against a class or struct into a chain of reflected properties.
+ *
+ * Compiling walks the type once; Resolve then only follows pointers, array indices and map keys on the instance.
+ * Each step is either a hop into a struct, an element of a fixed-size array, TArray or TMap, or a dereference of an
+ * object property ("StaticMeshComponent.StaticMesh"), in which case the next step is looked up on the declared class.
+ */
+class REMOTEMCP_API FMCPPropertyPath
+{
+public:
+	/** The property whose value Resolve returns; the element property when the path ends in an index. */
+	FProperty* GetLeafProperty() const
+	{
+		return Steps.Last().ValueProperty;
+	}
+
+	/** The top-level property of the path on the compiled class. */
+	FProperty* GetRootProperty() const
+	{
+		return Steps[0].Property;
+	}
+
+	const FString& ToString() const
+	{
+		return Path;
+	}
+
+	/**
+	 * Address of the leaf value on Object, or null with OutError set. With bAddMissingKeys a map key that does not exist
+	 * yet gets a default value, so setters can write through it; a failed resolve leaves the map as it was.
+	 */
+	void* Resolve(UObject* Object, FString& OutError, bool bAddMissingKeys = false) const;
+
+	/** Resolve and convert Value into the leaf property. A map entry added for the write is removed again if it fails. */
+	bool SetValue(UObject* Object, const TSharedPtr<FJsonValue>& Value, FString& OutError) const;
+
+private:
+	friend class FMCPPropertyPathCache;
+
+	enum class EAccess : uint8
+	{
+		Value,
+		StaticArray,
+		Array,
+		Map,
+	};
+
+	struct FStep
+	{
+		/** Property looked up on the current container. */
+		FProperty* Property = nullptr;
+		/** Property of the value this step lands on: Property itself, the array inner or the map value. */
+		FProperty* ValueProperty = nullptr;
+		EAccess Access = EAccess::Value;
+		int32 Index = 0;
+		/** Map key as text; imported into the key property on each Resolve. */
+		FString Key;
+		/** The value is an object reference and the path continues on the referenced object. */
+		bool bDereference = false;
+	};
+
+	/** The outermost map entry a resolve added, so a failed write can take it out again. */
+	struct FAddedKey
+	{
+		FMapProperty* Map = nullptr;
+		void* MapAddress = nullptr;
+		int32 Index = INDEX_NONE;
+
+		void Remove();
+	};
+
+	static bool Compile(const UStruct* Struct, const FString& Path, FMCPPropertyPath& Out, FString& OutError);
+	void* Resolve(UObject* Object, FString& OutError, bool bAddMissingKeys, FAddedKey& OutAdded) const;
+
+	FString Path;
+	TArray<FStep> Steps;
+};
+
+/**
+ * Compiled property paths keyed by (class, path), shared by every handler that writes properties by name.
+ *
+ * Entries hold raw FProperty pointers, so the whole cache is dropped when classes can be reinstanced: Blueprint
+ * compiles, hot reload / Live Coding and object reinstancing.
+ */
+class REMOTEMCP_API FMCPPropertyPathCache
+{
+public:
+	static FMCPPropertyPathCache& Get();
+
+	void Initialize();
+	void Shutdown();
+
+	/** The compiled path, or null with OutError set when a segment does not exist on Struct. */
+	const FMCPPropertyPath* Find(const UStruct* Struct, const FString& Path, FString& OutError);
+
+	void Reset();
+
+private:
+	TMap<TPair<FObjectKey, FString>, TUniquePtr<FMCPPropertyPath>> Paths;
+
+	FDelegateHandle ReinstancedHandle;
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Structure/JsonParameter.h"
+#include "MCPTools/MCPPagination.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Layout/WidgetPath.h"
 #include "MCPSlateTools.generated.h"
@@ -45,7 +46,8 @@ public:
 
 	/**
 	 * 在所有（或指定）窗口中按 Widget 类型名称搜索 Widget
-	 * @param Params - 必填: type_name(string), 可选: window_index(int), window_title(string), max_depth(int, 默认8)
+	 * @param Params - 必填: type_name(string), 可选: window_index(int), window_title(string), max_depth(int, 默认8),
+	 *                 limit(int), cursor(string), fields(string/array) 分页与字段裁剪
 	 * @return 匹配的 Widget 列表（含文本、tag、所属窗口信息）
 	 */
 	UFUNCTION(BlueprintCallable, Category = "MCP|Slate")
@@ -159,7 +161,7 @@ public:
 
 	/**
 	 * 获取所有当前打开的 Dock Tab 列表（遍历 Widget 树中的 SDockTab）
-	 * @param Params - 无必填参数
+	 * @param Params - 无必填参数, 可选: limit(int), cursor(string), fields(string/array)
 	 * @return Tab 列表 JSON，每项含 label/role/is_foreground/in_window
 	 */
 	UFUNCTION(BlueprintCallable, Category = "MCP|Slate")
@@ -189,8 +191,8 @@ public:
 	static FJsonObjectParameter HandleShowNotification(const FJsonObjectParameter& Params);
 
 private:
-	/** 递归将 Widget 转换为 JSON 节点，children 按 max_depth 截断 */
-	static TSharedPtr<FJsonObject> WidgetToJson(TSharedRef<SWidget> Widget, int32 MaxDepth, int32 CurrentDepth);
+	/** 递归将 Widget 直接写入流式 JSON，children 按 max_depth 截断 */
+	static void WriteWidgetJson(FMCPJsonWriter::FWriter& Writer, TSharedRef<SWidget> Widget, int32 MaxDepth, int32 CurrentDepth);
 
 	/** 递归在 Widget 树中按类型名搜索，结果追加到 OutArray */
 	static void FindWidgetsByTypeRecursive(
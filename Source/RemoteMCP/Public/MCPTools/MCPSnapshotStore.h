@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UActorComponent;
+
+/**
+ * In-memory snapshots of actors and their components, for trying an edit and rolling it back in one step.
+ *
+ * Each object is serialized into a byte buffer with object references stored as paths and resolved again on restore,
+ * so a reference to an object that was deleted or reloaded in the meantime comes back as None instead of a dangling
+ * pointer. References to instanced subobjects (an actor's components) are left out; the components are restored from
+ * their own records. Snapshots live in a small LRU bounded by count and total size; restoring or looking one up makes
+ * it the most recent.
+ *
+ * Game thread only.
+ */
+class REMOTEMCP_API FMCPSnapshotStore
+{
+public:
+	struct FComponentRecord
+	{
+		TWeakObjectPtr<UActorComponent> Component;
+		FName Name;
+		TArray<uint8> Data;
+	};
+
+	struct FActorRecord
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FString Path;
+		TArray<uint8> Data;
+		TArray<FComponentRecord> Components;
+	};
+
+	struct FSnapshot
+	{
+		FString Id;
+		FDateTime Created;
+		TArray<FActorRecord> Actors;
+		int64 Bytes = 0;
+	};
+
+	static FMCPSnapshotStore& Get();
+
+	/** Serialize Actors and their components into a new snapshot and return its id. */
+	FString Capture(const TArray<AActor*>& Actors);
+
+	/**
+	 * Write a snapshot back onto the actors it was taken from. Actors that no longer exist are returned in OutMissing;
+	 * components added since the snapshot are left alone. The caller owns the transaction.
+	 */
+	bool Restore(const FString& Id, TArray<AActor*>& OutRestored, TArray<FString>& OutMissing, FString& OutError);
+
+	/** Most recent first. */
+	void GetSnapshots(TArray<TSharedRef<const FSnapshot>>& Out) const;
+
+	bool Remove(const FString& Id);
+	void Reset();
+
+private:
+	TSharedPtr<FSnapshot> Touch(const FString& Id);
+	void Evict();
+
+	/** Least recently used first. */
+	TArray<TSharedRef<FSnapshot>> Snapshots;
+	int64 TotalBytes = 0;
+	int32 NextId = 1;
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ConvexVolume.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+class UWorld;
+
+/**
+ * Uniform hash grid over the bounds of the actors in the current editor world, backing the spatial query tools.
+ *
+ * Built lazily from FMCPActorIndex on the first query and kept current through the level actor added/deleted and
+ * actor moved delegates; a moved actor is simply re-bucketed. Actors whose bounds would span too many cells
+ * (landscape, sky spheres, volumes) go to an overflow list that every query tests directly.
+ *
+ * Game thread only.
+ */
+class REMOTEMCP_API FMCPSpatialIndex
+{
+public:
+	struct FHit
+	{
+		AActor* Actor = nullptr;
+		/** Distance from the query point to the actor bounds; 0 when the point is inside. */
+		double Distance = 0.0;
+	};
+
+	static FMCPSpatialIndex& Get();
+
+	void Initialize();
+	void Shutdown();
+
+	/** Actors whose bounds intersect the sphere, nearest first. */
+	void QueryRadius(const FVector& Center, double Radius, TArray<FHit>& OutHits);
+	/** Actors whose bounds intersect (or, with bFullyInside, lie inside) the box, nearest to its center first. */
+	void QueryBox(const FBox& Box, bool bFullyInside, TArray<FHit>& OutHits);
+	/** Actors whose bounds intersect the frustum, nearest to Origin first. MaxDistance <= 0 means unbounded. */
+	void QueryFrustum(const FConvexVolume& Frustum, const FVector& Origin, double MaxDistance, TArray<FHit>& OutHits);
+	/** The Count actors nearest to Center. MaxDistance <= 0 means unbounded. */
+	void QueryNearest(const FVector& Center, int32 Count, double MaxDistance, TArray<FHit>& OutHits);
+
+	/** Re-bucket an actor after its transform changed outside the editor's move notifications. */
+	void NotifyActorMoved(AActor* Actor);
+
+	/** Force a full rebuild on the next query. */
+	void Invalidate();
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FBox Bounds;
+		FIntVector MinCell;
+		FIntVector MaxCell;
+		bool bOverflow = false;
+	};
+
+	void EnsureBuilt();
+	void AddActor(AActor* Actor);
+	void RemoveEntry(const FObjectKey& Key);
+	FIntVector ToCell(const FVector& Location) const;
+	/** Visit the entries bucketed in the cells overlapping Box, plus the overflow list, each once. */
+	template<typename VisitorType>
+	void ForEachCandidate(const FBox& Box, VisitorType&& Visitor);
+	template<typename VisitorType>
+	void ForEachEntry(VisitorType&& Visitor);
+
+	void OnLevelActorAdded(AActor* Actor);
+	void OnLevelActorDeleted(AActor* Actor);
+	void OnActorMoved(AActor* Actor);
+	void OnObjectPropertyChanged(UObject* Object, struct FPropertyChangedEvent& Event);
+
+	TWeakObjectPtr<UWorld> World;
+	bool bDirty = true;
+	/** Union of the bucketed bounds, so expanding searches know when to stop. */
+	FBox GridBounds = FBox(ForceInit);
+
+	TMap<FObjectKey, FEntry> Entries;
+	TMap<FIntVector, TArray<FObjectKey>> Cells;
+	TArray<FObjectKey> Overflow;
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorListChangedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle PropertyChangedHandle;
+	FDelegateHandle MapChangeHandle;
+};
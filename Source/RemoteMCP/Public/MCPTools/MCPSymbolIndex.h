@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Name lookups for classes and their callable functions, shared by every handler that takes a class or function name.
+ *
+ * Native classes are indexed by their short name ("GameplayStatics", "UGameplayStatics" and "/Script/Engine.GameplayStatics"
+ * all resolve); Blueprint classes, including Blueprint function libraries, are found through FMCPBlueprintResolver.
+ * Lookups can be restricted to subclasses of a base class, whose members are listed once per base on first use. A name
+ * that is not found exactly resolves to the unique class of that base ending in "_<Name>" ("CallFunction" ->
+ * K2Node_CallFunction, "Wait" -> BTTask_Wait); otherwise the error suggests the closest names.
+ *
+ * Functions are indexed per class on first use, inherited ones included. All tables are keyed by FName, which compares
+ * case-insensitively, so "getactorofclass" finds GetActorOfClass without a scan.
+ *
+ * The class tables are dropped when compiled-in classes are registered, when modules unload and on hot reload; function
+ * tables also when a Blueprint is compiled or reinstanced. Game thread only.
+ */
+class REMOTEMCP_API FMCPSymbolIndex
+{
+public:
+	static FMCPSymbolIndex& Get();
+
+	void Initialize();
+	void Shutdown();
+
+	/** A class by short name (with or without its U / A prefix), object path, or Blueprint name / path, derived from BaseClass when given. */
+	UClass* FindClass(const FString& Name, const UClass* BaseClass = nullptr);
+
+	/** As above; a miss sets OutError, with the closest class names as suggestions. */
+	UClass* FindClass(const FString& Name, const UClass* BaseClass, FString& OutError);
+
+	/** Up to MaxCount class names close to Name, best first. */
+	void SuggestClasses(const FString& Name, const UClass* BaseClass, TArray<FString>& OutNames, int32 MaxCount = 5);
+
+	/** A function callable on Class, declared there or inherited, matched case-insensitively. */
+	UFunction* FindFunction(const UClass* Class, const FString& Name);
+
+	void Reset();
+
+private:
+	void BuildClassIndex();
+	const TArray<UClass*>& GetSubclasses(const UClass* BaseClass);
+	UClass* FindNative(const FString& Name, const UClass* BaseClass) const;
+	void ResetClasses();
+	void ResetFunctions();
+
+	/** Short name -> native classes; names shared by classes of different modules keep every class. */
+	TMultiMap<FName, UClass*> Classes;
+	bool bClassesIndexed = false;
+
+	/** Native subclasses per base class, for suffix matches and suggestions. */
+	TMap<FObjectKey, TArray<UClass*>> Subclasses;
+
+	TMap<FObjectKey, TMap<FName, UFunction*>> Functions;
+
+	FDelegateHandle ClassesRegisteredHandle;
+	FDelegateHandle ModulesChangedHandle;
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle ReinstancedHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Structure/JsonParameter.h"
+
+using FMCPToolHandler = TFunction<FJsonObjectParameter(const FJsonObjectParameter&)>;
+
+/**
+ * Native dispatch table for the C++ tool handlers.
+ *
+ * Tools are registered as "<Class>.<Handler>" (e.g. "MCPEdGraphTools.HandleAddNode"). Lookups ignore case and
+ * underscores, so the python spelling "MCPEdGraphTools.handle_add_node" resolves to the same entry.
+ * Calls through the registry invoke the handler directly, without a python delegate or UFunction reflection hop.
+ *
+ * Handlers whose UFUNCTION carries meta=(MCPThreadSafe) are flagged thread-safe and may be run on worker threads by
+ * FMCPToolScheduler. Such a handler must not load or mutate objects off the game thread; when it cannot answer from
+ * already-loaded data it returns MakeGameThreadRequiredResponse() and is re-run on the game thread.
+ */
+class REMOTEMCP_API FMCPToolRegistry
+{
+public:
+	static FMCPToolRegistry& Get();
+
+	/** Register every built-in UMCP*Tools handler. Called once at module startup. */
+	void RegisterBuiltinTools();
+
+	void RegisterTool(const FString& Name, FMCPToolHandler Handler, bool bThreadSafe = false);
+	void UnregisterTool(const FString& Name);
+	void Reset();
+
+	bool HasTool(const FString& Name) const;
+	const FMCPToolHandler* FindTool(const FString& Name) const;
+	bool IsToolThreadSafe(const FString& Name) const;
+	TArray<FString> GetToolNames() const;
+
+	/** Invoke a registered tool. Unknown tools yield the standard error response. */
+	FJsonObjectParameter CallTool(const FString& Name, const FJsonObjectParameter& Params) const;
+
+	/**
+	 * Run an ordered list of tool calls in one go, wrapped in a single editor transaction.
+	 * @param Params
+	 *   - steps (array, required): [{ "tool": "<Class>.<Handler>", "arguments": {...}, "id": "optional" }, ...]
+	 *   - stop_on_error (bool, optional, default true): skip the remaining steps after the first failure.
+	 *   - transaction (bool, optional, default true): group every step into one undo entry.
+	 *   - transaction_name (string, optional)
+	 * Any string argument of the form "$ref:<step>.<path>" is replaced by the value at <path> in the result of an
+	 * earlier step, where <step> is a step index or id (e.g. "$ref:add_node.node_guid", "$ref:0.pins.1.name").
+	 * @return { success, completed, total, results: [{ index, id, tool, success, result | error }] }
+	 */
+	FJsonObjectParameter CallBatch(const FJsonObjectParameter& Params) const;
+
+	/** Response of a thread-safe handler that needs the game thread to finish (e.g. the asset is not loaded yet). */
+	static FJsonObjectParameter MakeGameThreadRequiredResponse();
+	static bool IsGameThreadRequired(const FJsonObjectParameter& Result);
+
+	/** Registry key for a tool name: underscores stripped, compared case-insensitively. */
+	static FName MakeToolKey(const FString& Name);
+
+private:
+	struct FToolEntry
+	{
+		FString Name;
+		FMCPToolHandler Handler;
+		bool bThreadSafe = false;
+	};
+
+	TMap<FName, FToolEntry> Tools;
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+#include "Containers/Ticker.h"
+#include "Structure/JsonParameter.h"
+#include "Structure/MCPStructure.h"
+
+/**
+ * Runs registry tools asynchronously.
+ *
+ * Tools flagged thread-safe (meta=(MCPThreadSafe)) only read, but what they read (graph node and pin arrays, Blueprint
+ * data) is edited on the game thread at any time. They are therefore queued and run in read windows: once per frame
+ * the game thread hands the queued thread-safe calls to the UE::Tasks pool and waits until they are done, so concurrent
+ * queries run in parallel with each other but never alongside an edit or a garbage collection. A window only starts
+ * calls while the python task budget (UMCPSubsystem::GetTaskBudgetMs) lasts; the rest wait for the next frame. Everything
+ * else, and any thread-safe call that answers MakeGameThreadRequiredResponse(), runs on the game thread.
+ *
+ * Results are kept as serialized JSON until the caller polls them with TryTakeResult. Results nobody collects expire
+ * after a few minutes, and only a bounded number is kept.
+ */
+class REMOTEMCP_API FMCPToolScheduler
+{
+public:
+	static FMCPToolScheduler& Get();
+
+	void Initialize();
+	void Shutdown();
+
+	/** Schedule a tool call and return its request id. */
+	int64 Submit(const FString& Name, const FString& Parameter);
+
+	/** Move the result of a finished request into OutResult. Returns false while the request is still running. */
+	bool TryTakeResult(int64 RequestId, FString& OutResult);
+
+	/** Drop queued calls and finished results that were never collected. */
+	void Reset();
+
+private:
+	struct FCall
+	{
+		int64 RequestId = 0;
+		FString Name;
+		FJsonObjectParameter Params;
+		EMCPJsonFormat Format = EMCPJsonFormat::Compact;
+	};
+
+	struct FResult
+	{
+		FString Json;
+		double CompletedTime = 0.0;
+	};
+
+	bool Tick(float DeltaTime);
+	/** Runs a prefix of Calls within the frame budget and returns how many it ran. */
+	int32 RunReadWindow(const TArray<FCall>& Calls);
+	void RunOnGameThread(int64 RequestId, const FString& Name, const FJsonObjectParameter& Params, EMCPJsonFormat Format);
+	void Complete(int64 RequestId, const FJsonObjectParameter& Result, EMCPJsonFormat Format);
+	void PruneResults(double Now);
+
+	FCriticalSection PendingLock;
+	TArray<FCall> PendingReads;
+
+	FCriticalSection ResultsLock;
+	TMap<int64, FResult> Results;
+	double LastPruneTime = 0.0;
+
+	std::atomic<int64> NextRequestId{ 1 };
+	FTSTicker::FDelegateHandle TickHandle;
+};
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Json.h"
 #include "Structure/JsonParameter.h"
+#include "MCPTools/MCPPagination.h"
 
 // Forward declarations
 class AActor;
@@ -38,9 +39,15 @@ public:
     // Actor utilities
     static TSharedPtr<FJsonValue> ActorToJson(AActor* Actor);
     static TSharedPtr<FJsonObject> ActorToJsonObject(AActor* Actor, bool bDetailed = false);
+    // Same layout as ActorToJson plus "path", written straight into a streaming response
+    static void WriteActorJson(FMCPJsonWriter::FWriter& Writer, AActor* Actor, const FMCPFieldMask& Fields = FMCPFieldMask());
+    // The fields of WriteActorJson without the enclosing object, for callers that append their own fields
+    static void WriteActorFields(FMCPJsonWriter::FWriter& Writer, AActor* Actor, const FMCPFieldMask& Fields = FMCPFieldMask());
     
     // Blueprint utilities
+    // Asset name or path; see FMCPBlueprintResolver. The overload with OutError explains a miss or an ambiguous name
     static UBlueprint* FindBlueprint(const FString& BlueprintName);
+    static UBlueprint* FindBlueprint(const FString& BlueprintName, FString& OutError);
     static UBlueprint* FindBlueprintByName(const FString& BlueprintName);
     static UEdGraph* FindOrCreateEventGraph(UBlueprint* Blueprint);
     
@@ -57,6 +64,7 @@ public:
     static UK2Node_Event* FindExistingEventNode(UEdGraph* Graph, const FString& EventName);
 
     // Property utilities
+    // PropertyName may be a nested path ("Struct.Member", "Array[2]", "Map[Key]"), see FMCPPropertyPath
     static bool SetObjectProperty(UObject* Object, const FString& PropertyName, 
                                  const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage);
 }; 
\ No newline at end of file
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-
+#include "Structure/MCPStructure.h"
 
 #include "MCPUtility.generated.h"
 
@@ -16,5 +16,15 @@ class REMOTEMCP_API UMCPUtility : public UBlueprintFunctionLibrary
 	GENERATED_BODY()
 public:
 	static TSharedRef<FJsonObject> ConvertStringToJsonObject(const FString& JsonString);
-	static FString ConvertJsonObjectToString(const TSharedRef<FJsonObject>& JsonObject);
+	static FString ConvertJsonObjectToString(const TSharedRef<FJsonObject>& JsonObject, EMCPJsonFormat Format = EMCPJsonFormat::Compact);
+
+	/** Serialize a tool result in the given format; compact results that are already serialized are returned as-is. */
+	static FString FormatResponse(const FJsonObjectParameter& Result, EMCPJsonFormat Format);
+
+	/**
+	 * Remove the reserved "response_format" field ("compact" / "pretty" / "abbreviated") from the call parameters
+	 * and return the format it selects, compact when there is none. UMCPSetting::ResponseFormat is not applied here:
+	 * python reads these results, and formats them for the client once, when they leave the MCP server.
+	 */
+	static EMCPJsonFormat TakeResponseFormat(FJsonObjectParameter& Params);
 };
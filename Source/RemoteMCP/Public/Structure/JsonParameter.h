@@ -7,6 +7,14 @@
 #include "GameFramework/Actor.h"
 #include "JsonParameter.generated.h"
 
+/**
+ * Json object passed between python and the C++ tools.
+ * JsonObject is the source of truth; JsonString is only materialized when the struct is saved or exported as text,
+ * so building or copying a parameter never re-encodes the whole object.
+ * A parameter can also wrap an already serialized response (see FromSerializedString); the object is then parsed only
+ * if somebody dereferences it. JsonString is returned as is only while no object exists: copies share the object and
+ * any of them may change it, so once there is one it is always re-encoded.
+ */
 USTRUCT(BlueprintType, meta = (DisplayName = "JsonObject"))
 struct FJsonObjectParameter
 {
@@ -16,7 +24,6 @@ public:
 	FJsonObjectParameter(const FString& Other)
 	{
 		JsonObjectFromString(Other);
-		JsonString = Other;
 	}
 
 	FJsonObjectParameter(const FJsonObjectWrapper& Other)
@@ -28,10 +35,6 @@ public:
 	FJsonObjectParameter(const TSharedPtr<FJsonObject>& Other)
 	{
 		JsonObject = Other;
-		if (JsonObject.IsValid())
-		{
-			JsonObjectToString(JsonString);
-		}
 	}
 
 	FJsonObjectParameter(const TSharedRef<FJsonObject>& Other) : FJsonObjectParameter(Other.ToSharedPtr())
@@ -39,6 +42,7 @@ public:
 
 	}
 private:
+	/** Serialized form; authoritative only while JsonObject is null, otherwise refreshed by MaterializeJsonString. */
 	UPROPERTY(EditAnywhere, Category = "JSON")
 	FString JsonString;
 public:
@@ -46,22 +50,43 @@ public:
 
 	REMOTEMCP_API FString ConvertToString() const
 	{
+		if (!JsonObject.IsValid())
+		{
+			return JsonString;
+		}
 		FString Result;
 		JsonObjectToString(Result);
 		return Result;
 	}
 
+	/** Encode JsonObject into JsonString; a serialized-only parameter keeps its string. */
+	REMOTEMCP_API const FString& MaterializeJsonString();
+
+	/** Wrap json text produced elsewhere (e.g. by FMCPJsonWriter) without parsing it. */
+	REMOTEMCP_API static FJsonObjectParameter FromSerializedString(FString&& Json);
+
+	/** True when the object is available without parsing JsonString first. */
+	bool HasJsonObject() const
+	{
+		return JsonObject.IsValid();
+	}
+
 
 
 	REMOTEMCP_API bool ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText);
 	REMOTEMCP_API bool ExportTextItem(FString& ValueStr, FJsonObjectParameter const& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const;
 	REMOTEMCP_API void PostSerialize(const FArchive& Ar);
+	REMOTEMCP_API bool Serialize(FArchive& Ar);
 
 	REMOTEMCP_API explicit operator bool() const;
 
 	REMOTEMCP_API bool JsonObjectToString(FString& Str) const;
 	REMOTEMCP_API bool JsonObjectFromString(const FString& Str);
 
+	/** UTF-8 variants of the above, reading and writing bytes without an intermediate TCHAR string. */
+	REMOTEMCP_API bool JsonObjectToUtf8(TArray<uint8>& OutBytes) const;
+	REMOTEMCP_API bool JsonObjectFromUtf8(TConstArrayView<uint8> Bytes);
+
 	/**
 	 * Returns the memory allocated by this object in Bytes, should NOT include sizeof(*this).
 	 */
@@ -70,28 +95,43 @@ public:
 
 	[[nodiscard]] FORCEINLINE FJsonObject* operator->() const
 	{
-		if (JsonObject.IsValid())
-		{
-			return JsonObject.Get();
-		}
-		return &EmptyDefaultObject;
+		EnsureJsonObject();
+		return JsonObject.IsValid() ? JsonObject.Get() : &EmptyDefaultObject;
 	}
 
 	operator TSharedPtr<FJsonObject>()
 	{
+		EnsureJsonObject();
 		return JsonObject;
 	}
 
 	operator const TSharedPtr<FJsonObject>&() const
 	{
+		EnsureJsonObject();
 		return JsonObject;
 	}
 
 	const TSharedPtr<FJsonObject>& GetJsonObject() const
 	{
+		EnsureJsonObject();
 		return JsonObject;
 	}
 private:
-	TSharedPtr<FJsonObject> JsonObject;
+	/** Parse JsonString into JsonObject when the parameter was built from serialized text. */
+	REMOTEMCP_API void EnsureJsonObject() const;
+
+	mutable TSharedPtr<FJsonObject> JsonObject;
 	static FJsonObject EmptyDefaultObject;
 };
+
+template<>
+struct TStructOpsTypeTraits<FJsonObjectParameter> : public TStructOpsTypeTraitsBase2<FJsonObjectParameter>
+{
+	enum
+	{
+		WithImportTextItem = true,
+		WithExportTextItem = true,
+		WithSerializer = true,
+		WithPostSerialize = true,
+	};
+};
@@ -25,8 +25,21 @@ enum EMCPServerState
 	None,
 	Runing,
 	Stop,
+	Starting,
+	Stopping,
 };
 
+/** Wire format of tool responses handed back to python. */
+UENUM(BlueprintType)
+enum class EMCPJsonFormat : uint8
+{
+	/** No whitespace. */
+	Compact,
+	/** Indented, for humans reading the raw response. */
+	Pretty,
+	/** Compact, well-known keys shortened and empty fields dropped; a "_keys" legend maps the short keys back. */
+	Abbreviated,
+};
 
 DECLARE_DYNAMIC_DELEGATE_RetVal_TwoParams(bool, FMCPBridgeFuncDelegate,  EMCPBridgeFuncType, Type, const FString&, Message);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FMCPBridgeCallback,  const FString&, Message);